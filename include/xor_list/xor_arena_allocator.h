@@ -0,0 +1,218 @@
+#ifndef XORLIST_XOR_ARENA_ALLOCATOR_H
+#define XORLIST_XOR_ARENA_ALLOCATOR_H
+
+#include <memory>           // ::std::shared_ptr, ::std::make_shared
+#include <vector>           // ::std::vector
+#include <new>              // ::operator new, ::operator delete, ::std::bad_alloc
+#include <type_traits>      // ::std::true_type, ::std::false_type
+#include <cstddef>          // ::std::size_t, ::std::max_align_t
+#include <cstdint>          // ::std::uintptr_t
+#include <limits>           // ::std::numeric_limits
+
+
+namespace xor_arena_detail
+{
+    // Bump allocator over a growing set of chunks
+    // reset() rewinds to the first chunk, the chunks are kept for reuse until the arena dies
+    class Arena final
+    {
+    public:
+        explicit Arena(::std::size_t chunkSize) noexcept
+            : chunkSize(chunkSize)
+        {}
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        ~Arena()
+        {
+            for (const Chunk &chunk : chunks)
+            {
+                ::operator delete(chunk.memory);
+            }
+        }
+
+
+        void* allocate(::std::size_t size, ::std::size_t alignment)
+        {
+            if (cursor != nullptr)
+            {
+                char *const result = align(cursor, alignment);
+
+                if ((result <= end) && (size <= static_cast<::std::size_t>(end - result)))
+                {
+                    cursor = result + size;
+                    return result;
+                }
+            }
+
+            return allocateSlow(size, alignment);
+        }
+
+        void reset() noexcept
+        {
+            current = 0;
+
+            if (chunks.empty())
+            {
+                cursor = end = nullptr;
+            }
+            else
+            {
+                cursor = chunks.front().memory;
+                end = cursor + chunks.front().size;
+            }
+        }
+
+    private:
+        struct Chunk
+        {
+            char *memory;
+            ::std::size_t size;
+        };
+
+
+        const ::std::size_t chunkSize;
+        ::std::vector<Chunk> chunks;
+        ::std::size_t current = 0;
+        char *cursor = nullptr;
+        char *end = nullptr;
+
+
+        static char* align(char *const pointer, ::std::size_t alignment) noexcept
+        {
+            const auto address = reinterpret_cast<::std::uintptr_t>(pointer);
+            return reinterpret_cast<char*>((address + alignment - 1) / alignment * alignment);
+        }
+
+        void* allocateSlow(::std::size_t size, ::std::size_t alignment)
+        {
+            // Room for aligning the start of a chunk
+            if (size > ::std::numeric_limits<::std::size_t>::max() - alignment)
+            {
+                throw ::std::bad_alloc();
+            }
+
+            const ::std::size_t required = size + alignment;
+
+            ::std::size_t next = chunks.empty() ? 0 : current + 1;
+            while ((next < chunks.size()) && (chunks[next].size < required))
+            {
+                ++next;
+            }
+
+            if (next == chunks.size())
+            {
+                const ::std::size_t newSize = (required > chunkSize) ? required : chunkSize;
+
+                chunks.reserve(chunks.size() + 1);
+                chunks.push_back({ static_cast<char*>(::operator new(newSize)), newSize });
+            }
+
+            current = next;
+            cursor = align(chunks[current].memory, alignment);
+            end = chunks[current].memory + chunks[current].size;
+
+            char *const result = cursor;
+            cursor += size;
+            return result;
+        }
+    };
+}
+
+
+// Monotonic allocator: deallocate() does nothing, the memory is reused after the arena is reset
+// Containers from this library reset the arena on clear() when they are its only user
+//  (see xor_list::clear()), copies and rebound copies share the arena
+// WARNING! Not thread-safe: copies must not be used concurrently
+template<typename T, ::std::size_t ChunkSize = 64 * 1024>
+class xor_arena_allocator
+{
+    static_assert(ChunkSize > 0, "Chunk must not be empty");
+    static_assert(alignof(T) <= alignof(::std::max_align_t), "Over-aligned types aren't supported");
+
+public:
+    using value_type = T;
+    using is_monotonic = ::std::true_type;
+    using propagate_on_container_copy_assignment = ::std::false_type;
+    using propagate_on_container_move_assignment = ::std::true_type;
+    using propagate_on_container_swap = ::std::true_type;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = xor_arena_allocator<U, ChunkSize>;
+    };
+
+
+    xor_arena_allocator()
+        : arena(::std::make_shared<xor_arena_detail::Arena>(ChunkSize))
+    {}
+
+    template<typename U>
+    xor_arena_allocator(const xor_arena_allocator<U, ChunkSize> &other) noexcept
+        : arena(other.arena)
+    {}
+
+    // No move operations: a moved-from allocator must stay usable
+    xor_arena_allocator(const xor_arena_allocator&) noexcept = default;
+    xor_arena_allocator& operator=(const xor_arena_allocator&) noexcept = default;
+
+    ~xor_arena_allocator() = default;
+
+
+    // A copy of a container gets its own arena
+    xor_arena_allocator select_on_container_copy_construction() const
+    {
+        return xor_arena_allocator();
+    }
+
+    T* allocate(::std::size_t n)
+    {
+        if (n > ::std::numeric_limits<::std::size_t>::max() / sizeof(T))
+        {
+            throw ::std::bad_alloc();
+        }
+
+        return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T*, ::std::size_t) noexcept
+    {
+    }
+
+    // Rewinds the arena if nobody else uses it
+    // WARNING! All the memory allocated through this allocator becomes invalid
+    bool reset() noexcept
+    {
+        if (arena.use_count() != 1)
+        {
+            return false;
+        }
+
+        arena->reset();
+        return true;
+    }
+
+
+    template<typename U>
+    bool operator==(const xor_arena_allocator<U, ChunkSize> &right) const noexcept
+    {
+        return (arena == right.arena);
+    }
+
+    template<typename U>
+    bool operator!=(const xor_arena_allocator<U, ChunkSize> &right) const noexcept
+    {
+        return !(*this == right);
+    }
+
+private:
+    template<typename U, ::std::size_t C>
+    friend class xor_arena_allocator;
+
+
+    ::std::shared_ptr<xor_arena_detail::Arena> arena;
+};
+
+#endif //XORLIST_XOR_ARENA_ALLOCATOR_H
@@ -0,0 +1,664 @@
+#ifndef XORLIST_XOR_INTRUSIVE_LIST_H
+#define XORLIST_XOR_INTRUSIVE_LIST_H
+
+#include "xor_list_hook.h"   // xor_list_hook, xor_list_detail
+
+#include <memory>           // ::std::addressof
+#include <utility>          // ::std::move, ::std::pair
+#include <functional>       // ::std::less, ::std::equal_to
+#include <iterator>         // ::std::bidirectional_iterator_tag, ::std::next
+#include <cstddef>          // ::std::size_t, ::std::ptrdiff_t
+#include <tuple>            // ::std::tie
+#include <limits>           // ::std::numeric_limits
+
+
+// XOR linked list of the objects which embed xor_list_hook as the Hook member
+// The list neither allocates nor owns the objects: they must outlive their membership
+// An object can't be found in the list by its address (its neighbours are unknown), so there is no iterator_to
+template<typename T, xor_list_hook T::*Hook>
+class xor_intrusive_list
+{
+private:
+    template<typename It, typename V>
+    class IteratorBase;
+
+    using Node = xor_list_detail::Node;
+
+public:
+    class const_iterator;
+
+    class iterator : public IteratorBase<iterator, T>
+    {
+    public:
+        iterator() noexcept = default;
+        iterator(const iterator&) noexcept = default;
+        iterator(iterator&&) noexcept = default;
+
+        ~iterator() noexcept = default;
+
+        iterator& operator=(const iterator&) noexcept = default;
+        iterator& operator=(iterator&&) noexcept = default;
+
+
+        operator const_iterator() const noexcept
+        {
+            return { this->prev, this->current };
+        }
+
+    private:
+        friend class xor_intrusive_list<T, Hook>;
+        friend class const_iterator;
+        friend struct xor_list_detail::Sequences<iterator, const_iterator>;
+
+
+        iterator(Node *prev, Node *current) noexcept
+            : IteratorBase<iterator, T>(prev, current)
+        {
+        }
+    };
+
+    class const_iterator : public IteratorBase<const_iterator, const T>
+    {
+    public:
+        const_iterator() noexcept = default;
+        const_iterator(const const_iterator&) noexcept = default;
+        const_iterator(const_iterator&&) noexcept = default;
+
+        ~const_iterator() noexcept = default;
+
+        const_iterator& operator=(const const_iterator&) noexcept = default;
+        const_iterator& operator=(const_iterator&&) noexcept = default;
+
+    private:
+        friend class xor_intrusive_list<T, Hook>;
+        friend class iterator;
+        friend struct xor_list_detail::Sequences<iterator, const_iterator>;
+
+
+        const_iterator(Node *prev, Node *current) noexcept
+            : IteratorBase<const_iterator, const T>(prev, current)
+        {
+        }
+
+        explicit operator iterator() const noexcept
+        {
+            return { this->prev, this->current };
+        }
+    };
+
+    using value_type = T;
+    using size_type = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+
+
+    xor_intrusive_list() noexcept
+        : beforeHead(&afterTail), afterTail(&beforeHead)
+    {}
+
+    xor_intrusive_list(const xor_intrusive_list&) = delete;
+
+    xor_intrusive_list(xor_intrusive_list &&other) noexcept
+        : beforeHead(&afterTail), afterTail(&beforeHead)
+    {
+        splice(cbegin(), other);
+    }
+
+    // Unlinks all the objects
+    ~xor_intrusive_list()
+    {
+        clear();
+    }
+
+    xor_intrusive_list& operator=(const xor_intrusive_list&) = delete;
+
+    xor_intrusive_list& operator=(xor_intrusive_list &&right) noexcept
+    {
+        if (this != ::std::addressof(right))
+        {
+            clear();
+            splice(cbegin(), right);
+        }
+        return *this;
+    }
+
+    void swap(xor_intrusive_list &other) noexcept
+    {
+        const auto thisDistance = size();
+        const auto otherDistance = other.size();
+
+        if (!empty())
+        {
+            auto thisCutResult = cutSequenceFromThis(cbegin(), cend(), thisDistance);
+
+            if (!other.empty())
+            {
+                auto otherCutResult = other.cutSequenceFromThis(other.cbegin(), other.cend(), otherDistance);
+                (void)insertSequenceToThisBefore(cbegin(), otherCutResult.cutted.first, otherCutResult.cutted.second,
+                                                 otherDistance);
+            }
+
+            (void)other.insertSequenceToThisBefore(other.cbegin(), thisCutResult.cutted.first,
+                                                   thisCutResult.cutted.second, thisDistance);
+        }
+        else if (!other.empty())
+        {
+            auto otherCutResult = other.cutSequenceFromThis(other.cbegin(), other.cend(), otherDistance);
+            (void)insertSequenceToThisBefore(cbegin(), otherCutResult.cutted.first, otherCutResult.cutted.second,
+                                             otherDistance);
+        }
+    }
+
+    // WARNING! value must not be linked into any list
+    void push_back(reference value) noexcept
+    {
+        (void)insert(cend(), value);
+    }
+
+    // WARNING! value must not be linked into any list
+    void push_front(reference value) noexcept
+    {
+        (void)insert(cbegin(), value);
+    }
+
+    void pop_front() noexcept
+    {
+        (void)erase(cbegin());
+    }
+
+    void pop_back() noexcept
+    {
+        (void)erase(--cend());
+    }
+
+    size_type size() const noexcept
+    {
+        return length;
+    }
+
+    size_type max_size() const noexcept
+    {
+        return ::std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    bool empty() const noexcept
+    {
+        return (size() == 0);
+    }
+
+    // Unlinks all the objects
+    void clear() noexcept
+    {
+        unlinkSequence(cbegin(), cend(), size());
+    }
+
+    T& back()
+    {
+        return *(--end());
+    }
+
+    const T& back() const
+    {
+        return *(--cend());
+    }
+
+    T& front()
+    {
+        return *begin();
+    }
+
+    const T& front() const
+    {
+        return *cbegin();
+    }
+
+    // Iterators and such
+    iterator begin() noexcept
+    {
+        return { ::std::addressof(beforeHead), reinterpret_cast<Node*>(beforeHead.xorPtr) };
+    }
+
+    iterator end() noexcept
+    {
+        return { reinterpret_cast<Node*>(afterTail.xorPtr), ::std::addressof(afterTail) };
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return { ::std::addressof(beforeHead), reinterpret_cast<Node*>(beforeHead.xorPtr) };
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return { reinterpret_cast<Node*>(afterTail.xorPtr), ::std::addressof(afterTail) };
+    }
+
+    void sort()
+    {
+        sort(::std::less<T>{});
+    }
+
+    // Stable natural merge sort by relinking (see xor_list_detail::Sequences::sortSequence)
+    // If isLess throws, the list keeps all its objects in unspecified order
+    template<typename Compare>
+    void sort(Compare isLess)
+    {
+        const auto thisSize = size();
+
+        if (thisSize < 2)
+        {
+            return;
+        }
+
+        typename Sequences::Range sequence = cutSequenceFromThis(cbegin(), cend(), thisSize).cutted;
+
+        try
+        {
+            Sequences::sortSequence(sequence, isLess);
+        }
+        catch (...)
+        {
+            (void)insertSequenceToThisBefore(cend(), sequence.first, sequence.second, thisSize);
+            throw;
+        }
+
+        (void)insertSequenceToThisBefore(cend(), sequence.first, sequence.second, thisSize);
+    }
+
+    // WARNING! value must not be linked into any list
+    // WARNING! Iterators equal to position will become invalid
+    iterator insert(const_iterator position, reference value) noexcept
+    {
+        return insertNodeToThisBefore(position, toNode(value)).first;
+    }
+
+    // WARNING! Iterators equal to position will become invalid
+    // Not noexcept: InputIterator may throw, the objects linked before that stay in the list
+    template<typename InputIterator>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last)
+    {
+        if (first == last)
+        {
+            return static_cast<iterator>(position);
+        }
+
+        const iterator result = insert(position, *first);
+        position = result;
+
+        for (++position ; ++first != last; ++position)
+        {
+            position = insert(position, *first);
+        }
+
+        return result;
+    }
+
+    // WARNING! All iterators will become invalid
+    // Complexity: O(1)
+    void reverse() noexcept
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        using xor_list_detail::xorPointers;
+
+        auto first = cbegin();
+        auto last = --cend();
+
+        first.current->xorPtr = xorPointers(xorPointers(first.current->xorPtr, ::std::addressof(beforeHead)),
+                                            ::std::addressof(afterTail));
+        last.current->xorPtr = xorPointers(xorPointers(last.current->xorPtr, ::std::addressof(afterTail)),
+                                           ::std::addressof(beforeHead));
+
+        beforeHead.xorPtr = reinterpret_cast<xor_list_detail::PtrInteger>(last.current);
+        afterTail.xorPtr = reinterpret_cast<xor_list_detail::PtrInteger>(first.current);
+    }
+
+    // Reverses [first, last) of this list, returns the reversed range
+    // WARNING! Iterators to the elements of [first, last] will become invalid
+    // Complexity: O(1)
+    ::std::pair<iterator, iterator> reverse(const_iterator first, const_iterator last) noexcept
+    {
+        return Sequences::reverseSequence(first, last);
+    }
+
+    // Makes new_first the first element keeping the cyclic order, like ::std::rotate(begin(), new_first, end())
+    // Returns an iterator to the element that was the first one
+    // WARNING! Iterators to the first and the last elements, equal to new_first and end() will become invalid
+    // Complexity: O(1)
+    iterator rotate(const_iterator new_first) noexcept
+    {
+        if (new_first == cbegin())
+        {
+            return end();
+        }
+        if (new_first == cend())
+        {
+            return begin();
+        }
+
+        const auto cutResult = Sequences::cutSequence(cbegin(), new_first);
+        return Sequences::insertSequenceBefore(cend(), cutResult.cutted.first, cutResult.cutted.second).first;
+    }
+
+    // Unlinks the object, doesn't destroy it
+    // WARNING! Iterators in the range [position, position + 1] will become invalid
+    iterator erase(const_iterator position) noexcept
+    {
+        return erase(position, ::std::next(position));
+    }
+
+    // Unlinks the objects, doesn't destroy them
+    // WARNING! Iterators in the range [first, last] will become invalid
+    iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        if (first != last)
+        {
+            unlinkSequence(first, last, ::std::distance(first, last));
+        }
+
+        return { first.prev, last.current };
+    }
+
+    template<typename UnaryPredicate>
+    size_type remove_if(UnaryPredicate p)
+    {
+        size_type result = 0;
+
+        for (const_iterator iter = cbegin(); iter != cend();)
+        {
+            if (p(*iter))
+            {
+                iter = erase(iter);
+                ++result;
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return result;
+    }
+
+
+    void splice(const_iterator position, xor_intrusive_list &x) noexcept
+    {
+        if ((this == ::std::addressof(x)) || (x.empty()))
+        {
+            return;
+        }
+
+        const auto distance = x.size();
+        const auto range = x.cutSequenceFromThis(x.cbegin(), x.cend(), distance).cutted;
+
+        (void)insertSequenceToThisBefore(position, range.first, range.second, distance);
+    }
+
+    void splice(const_iterator position, xor_intrusive_list &x, const_iterator i) noexcept
+    {
+        if ((this == ::std::addressof(x)) && ((position == i) || (position.prev == i.current)))
+        {
+            return;
+        }
+
+        const auto range = x.cutSequenceFromThis(i, ::std::next(i), 1).cutted;
+        (void)insertNodeToThisBefore(position, range.first.current);
+    }
+
+    void splice(const_iterator position, xor_intrusive_list &x, const_iterator first, const_iterator last) noexcept
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        const size_type distance = (this == ::std::addressof(x)) ? 0 : ::std::distance(first, last);
+
+        ::std::tie(first, last) = x.cutSequenceFromThis(first, last, distance).cutted;
+        (void)insertSequenceToThisBefore(position, first, last, distance);
+    }
+
+    // All iterators will become invalid
+    void unique()
+    {
+        unique(::std::equal_to<T>{});
+    }
+
+    // All iterators will become invalid
+    template<typename BinaryPredicate>
+    void unique(BinaryPredicate isEqual)
+    {
+        if (size() < 2)
+        {
+            return;
+        }
+
+        auto current = cbegin();
+        for (auto prev = current++; current != cend(); )
+        {
+            if (isEqual(*prev, *current))
+            {
+                current = erase(current);
+            }
+            else
+            {
+                prev = current++;
+            }
+        }
+    }
+
+    // All iterators from *this and x will become invalid
+    void merge(xor_intrusive_list &x)
+    {
+        merge(x, ::std::less<T>{});
+    }
+
+    // All iterators from *this and x will become invalid
+    template<typename Compare>
+    void merge(xor_intrusive_list &x, Compare isLess)
+    {
+        if ((this != ::std::addressof(x)) && (!x.empty()))
+        {
+            const auto distance = x.size();
+            const auto range = x.cutSequenceFromThis(x.cbegin(), x.cend(), distance).cutted;
+
+            (void)mergeSequencesToThis(cbegin(), cend(), range.first, range.second, ::std::move(isLess), distance);
+        }
+    }
+
+private:
+    using Sequences = xor_list_detail::Sequences<iterator, const_iterator>;
+    using CutResult = typename Sequences::CutResult;
+
+
+    template<typename It, typename V>
+    class IteratorBase
+    {
+    public:
+        // =========================== Iterator Concept ===============================
+        using difference_type = ::std::ptrdiff_t;
+        using value_type = V;
+        using pointer = value_type*;
+        using reference = value_type&;
+        using iterator_category = ::std::bidirectional_iterator_tag;
+
+
+        reference operator*() const
+        {
+            return *toValue(current);
+        }
+
+        It& operator++()
+        {
+            Node *next = reinterpret_cast<Node*>(xor_list_detail::xorPointers(prev, current->xorPtr));
+
+            prev = current;
+            current = next;
+
+            return static_cast<It&>(*this);
+        }
+        // ======================== End Iterator Concept ==============================
+
+        // ====================== Input/Forward Iterator Concept ======================
+        bool operator==(const It &right) const noexcept
+        {
+            return (current == right.current);
+        }
+
+        bool operator!=(const It &right) const noexcept
+        {
+            return !(*this == right);
+        }
+
+        pointer operator->() const
+        {
+            return toValue(current);
+        }
+
+        It operator++(int)
+        {
+            It result(static_cast<It&>(*this));
+            (void)++(*this);
+            return result;
+        }
+        // ==================== End Input/Forward Iterator Concept ====================
+
+        // ===================== Bidirectional Iterator Concept =======================
+        It& operator--()
+        {
+            Node *newPrev = reinterpret_cast<Node*>(xor_list_detail::xorPointers(prev->xorPtr, current));
+
+            current = prev;
+            prev = newPrev;
+
+            return static_cast<It&>(*this);
+        }
+
+        It operator--(int)
+        {
+            It result(static_cast<It&>(*this));
+            (void)--(*this);
+            return result;
+        }
+        // =================== End Bidirectional Iterator Concept =====================
+    protected:
+        Node *prev;
+        Node *current;
+
+
+        IteratorBase(Node *prev = nullptr, Node *current = nullptr) noexcept
+            : prev(prev), current(current)
+        {
+        }
+
+        IteratorBase(const IteratorBase&) noexcept = default;
+        IteratorBase(IteratorBase&&) noexcept = default;
+
+        ~IteratorBase() noexcept = default;
+
+        IteratorBase& operator=(const IteratorBase&) noexcept = default;
+        IteratorBase& operator=(IteratorBase&&) noexcept = default;
+
+    private:
+        friend class xor_intrusive_list<T, Hook>;
+        friend struct xor_list_detail::Sequences<iterator, const_iterator>;
+    };
+
+
+    mutable Node beforeHead;
+    mutable Node afterTail;
+    size_type length = 0;
+
+
+    static Node* toNode(reference value) noexcept
+    {
+        (void)hookOffset(::std::addressof(value));
+        return static_cast<Node*>(::std::addressof(value.*Hook));
+    }
+
+    static T* toValue(Node *const node) noexcept
+    {
+        xor_list_hook *const hook = static_cast<xor_list_hook*>(node);
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - hookOffset());
+    }
+
+    // Offset of the hook inside T
+    // A pointer to member can't be applied to raw storage, so the offset is measured on the first object
+    //  passed to toNode(): every node reaching toValue() has been linked through toNode() before
+    static ::std::ptrdiff_t hookOffset(const T *const object = nullptr) noexcept
+    {
+        static const ::std::ptrdiff_t offset = reinterpret_cast<const char*>(::std::addressof(object->*Hook))
+                                               - reinterpret_cast<const char*>(object);
+        return offset;
+    }
+
+
+    ::std::pair<iterator, iterator>
+    insertNodeToThisBefore(const_iterator position, Node *const node) noexcept
+    {
+        ++length;
+        return Sequences::insertNodeBefore(position, node);
+    }
+
+    template<typename I>
+    ::std::pair<iterator, iterator>
+    insertSequenceToThisBefore(const_iterator position, const_iterator begin,
+                               const_iterator end, I distance) noexcept
+    {
+        length += distance;
+        return Sequences::insertSequenceBefore(position, begin, end);
+    }
+
+    template<typename I>
+    CutResult
+    cutSequenceFromThis(const_iterator first, const_iterator last, I distance) noexcept
+    {
+        length -= distance;
+        return Sequences::cutSequence(first, last);
+    }
+
+    // Leaves the hooks of the unlinked objects zeroed (see xor_list_hook::is_linked)
+    template<typename I>
+    void unlinkSequence(const_iterator begin, const_iterator end, I distance) noexcept
+    {
+        if (distance == 0)
+        {
+            return;
+        }
+
+        ::std::tie(begin, end) = cutSequenceFromThis(begin, end, distance).cutted;
+
+        for (; begin != end; )
+        {
+            (++begin).prev->xorPtr = 0;
+        }
+    }
+
+    template<typename LessCompare, typename I>
+    ::std::pair<iterator, iterator>
+    mergeSequencesToThis(const_iterator beginTo, const_iterator endTo,
+                         const_iterator beginFrom, const_iterator endFrom,
+                         LessCompare &&isLess, I distance) noexcept
+    {
+        length += distance;
+        return Sequences::mergeSequences(beginTo, endTo, beginFrom, endFrom, ::std::forward<LessCompare>(isLess));
+    }
+};
+
+#endif //XORLIST_XOR_INTRUSIVE_LIST_H
@@ -1,28 +1,217 @@
 #ifndef XORLIST_XOR_LIST_H
 #define XORLIST_XOR_LIST_H
 
+#include "xor_list_detail.h" // xor_list_detail
+
 #include <initializer_list> // ::std::initializer_list
 #include <memory>           // ::std::allocator, ::std::allocator_traits, ::std::addressof
-#include <utility>          // ::std::move, ::std::forward, ::std::pair
+#include <vector>           // ::std::vector
+#include <utility>          // ::std::move, ::std::forward, ::std::pair, ::std::declval
 #include <functional>       // ::std::less, ::std::equal_to
 #include <iterator>         // ::std::bidirectional_iterator_tag, ::std::next, ::std::iterator_traits
-#include <type_traits>      // ::std::conditional, ::std::enable_if, ::std::is_base_of
-#include <cstdint>          // ::std::uint*_t
+#include <type_traits>      // ::std::enable_if, ::std::is_base_of, ::std::is_polymorphic, ::std::is_trivially_destructible,
+                            // ::std::is_same, ::std::is_nothrow_move_constructible, ::std::is_nothrow_move_assignable,
+                            // ::std::is_integral, ::std::is_unsigned, ::std::make_unsigned, ::std::decay
 #include <cstddef>          // ::std::ptrdiff_t
-#include <algorithm>        // ::std::swap, ::std::equal, ::std::lexicographical_compare
+#include <algorithm>        // ::std::swap, ::std::sort, ::std::min
 #include <tuple>            // ::std::tie
 #include <array>            // ::std::array
 #include <limits>           // ::std::numeric_limits
+#include <new>              // placement new
+#include <thread>           // ::std::thread
+
+
+// xor_list::sort() sorts lists with at least this many elements through a buffer of node pointers
+#ifndef XOR_LIST_SORT_BUFFER_THRESHOLD
+#define XOR_LIST_SORT_BUFFER_THRESHOLD 100000
+#endif
+
+
+// Size policies of xor_list
+
+// The number of elements is kept: size() is O(1), splice of a range from another list is O(n)
+struct xor_list_tracked_size
+{
+};
+
+// The number of elements isn't kept: size() is O(n), splice of any range is O(1)
+struct xor_list_untracked_size
+{
+};
+
+
+// Makes xor_list::sort() split the list between several threads
+struct xor_list_parallel_policy
+{
+    // 0 means ::std::thread::hardware_concurrency()
+    unsigned threads;
+
+
+    explicit xor_list_parallel_policy(unsigned threads = 0) noexcept
+        : threads(threads)
+    {}
+};
+
+
+namespace xor_list_detail
+{
+    template<typename...>
+    struct MakeVoid
+    {
+        using type = void;
+    };
+
+    // Monotonic allocators (is_monotonic = std::true_type) free nothing in deallocate()
+    //  and can release everything at once with reset() (see xor_arena_allocator)
+    template<typename TAllocator, typename = void>
+    struct IsMonotonicAllocator : ::std::false_type
+    {
+    };
+
+    template<typename TAllocator>
+    struct IsMonotonicAllocator<TAllocator, typename MakeVoid<typename TAllocator::is_monotonic>::type>
+        : ::std::integral_constant<bool, TAllocator::is_monotonic::value>
+    {
+    };
+
+    // Pooled allocators (is_pooled = std::true_type) carve single nodes from a few big slabs,
+    //  so nodes ordered by address are nearly contiguous (see xor_pool_allocator)
+    template<typename TAllocator, typename = void>
+    struct IsPooledAllocator : ::std::false_type
+    {
+    };
+
+    template<typename TAllocator>
+    struct IsPooledAllocator<TAllocator, typename MakeVoid<typename TAllocator::is_pooled>::type>
+        : ::std::integral_constant<bool, TAllocator::is_pooled::value>
+    {
+    };
+
+    // destroy() of ::std::allocator only calls the destructor
+    template<typename TAllocator, typename U, typename = void>
+    struct HasCustomDestroy : ::std::false_type
+    {
+    };
+
+    template<typename TAllocator, typename U>
+    struct HasCustomDestroy<TAllocator, U,
+                            typename MakeVoid<decltype(::std::declval<TAllocator&>().destroy(::std::declval<U*>()))>::type>
+        : ::std::integral_constant<bool, !::std::is_same<TAllocator, ::std::allocator<U>>::value>
+    {
+    };
+
+    // destroy() may be skipped
+    template<typename TAllocator, typename U>
+    struct IsTriviallyDestroyable
+        : ::std::integral_constant<bool, ::std::is_trivially_destructible<U>::value && !HasCustomDestroy<TAllocator, U>::value>
+    {
+    };
+
+    // Allocators with deallocate_chain(first, last, count) free count single-object blocks at once
+    //  (see xor_pool_allocator), the blocks are linked from first to last through a void* at their beginning
+    template<typename TAllocator, typename = void>
+    struct HasDeallocateChain : ::std::false_type
+    {
+    };
+
+    template<typename TAllocator>
+    struct HasDeallocateChain<TAllocator,
+                              typename MakeVoid<decltype(::std::declval<TAllocator&>().deallocate_chain(
+                                  ::std::declval<typename TAllocator::value_type*>(),
+                                  ::std::declval<typename TAllocator::value_type*>(),
+                                  ::std::size_t{}))>::type>
+        : ::std::true_type
+    {
+    };
+
+
+    // Number of elements of a container according to SizePolicy
+    // Empty for xor_list_untracked_size, so the container can drop it via empty base optimization
+    template<typename SizePolicy>
+    class SizeCounter;
+
+    template<>
+    class SizeCounter<xor_list_tracked_size>
+    {
+    protected:
+        static constexpr bool tracksSize = true;
+
+
+        ::std::size_t countedSize() const noexcept
+        {
+            return length;
+        }
+
+        void addToSize(const ::std::size_t count) noexcept
+        {
+            length += count;
+        }
+
+        void subtractFromSize(const ::std::size_t count) noexcept
+        {
+            length -= count;
+        }
+
+        void resetSize() noexcept
+        {
+            length = 0;
+        }
+
+    private:
+        ::std::size_t length = 0;
+    };
+
+    template<>
+    class SizeCounter<xor_list_untracked_size>
+    {
+    protected:
+        static constexpr bool tracksSize = false;
+
+
+        ::std::size_t countedSize() const noexcept
+        {
+            return 0;
+        }
+
+        void addToSize(::std::size_t) noexcept
+        {
+        }
+
+        void subtractFromSize(::std::size_t) noexcept
+        {
+        }
+
+        void resetSize() noexcept
+        {
+        }
+    };
+
+
+    // Radix sort key of an integral value: the sign bit is flipped, so negative values go first
+    template<typename T>
+    struct IntegralKey
+    {
+        using Key = typename ::std::make_unsigned<T>::type;
+
+
+        Key operator()(const T value) const noexcept
+        {
+            return static_cast<Key>(static_cast<Key>(value)
+                                    ^ (::std::is_signed<T>::value ? (Key(1) << (::std::numeric_limits<Key>::digits - 1))
+                                                                  : Key(0)));
+        }
+    };
+}
 
 
-template<typename T, class TAllocator = ::std::allocator<T>>
-class xor_list
+template<typename T, class TAllocator = ::std::allocator<T>, class SizePolicy = xor_list_tracked_size>
+class xor_list : private xor_list_detail::SizeCounter<SizePolicy>
 {
 private:
     template<typename It, typename V>
     class IteratorBase;
 
-    struct Node;
+    using Node = xor_list_detail::Node;
 
 public:
     class const_iterator;
@@ -46,8 +235,9 @@ public:
         }
 
     private:
-        friend class xor_list<T, TAllocator>;
+        friend class xor_list<T, TAllocator, SizePolicy>;
         friend class const_iterator;
+        friend struct xor_list_detail::Sequences<iterator, const_iterator>;
 
 
         iterator(Node *prev, Node *current) noexcept
@@ -69,8 +259,9 @@ public:
         const_iterator& operator=(const_iterator&&) noexcept = default;
 
     private:
-        friend class xor_list<T, TAllocator>;
+        friend class xor_list<T, TAllocator, SizePolicy>;
         friend class iterator;
+        friend struct xor_list_detail::Sequences<iterator, const_iterator>;
 
 
         const_iterator(Node *prev, Node *current) noexcept
@@ -133,11 +324,15 @@ public:
         {
             splice(cbegin(), other);
         }
+
+        // The cached nodes belong to the moved allocator
+        swapCaches(other);
     }
 
     ~xor_list()
     {
         clear();
+        releaseCache();
     }
 
     xor_list& operator=(const xor_list &right)
@@ -210,9 +405,10 @@ public:
         (void)erase(--cend());
     }
 
+    // Complexity: O(1) with xor_list_tracked_size, O(n) with xor_list_untracked_size
     size_type size() const noexcept
     {
-        return length;
+        return this->tracksSize ? this->countedSize() : static_cast<size_type>(::std::distance(cbegin(), cend()));
     }
 
     size_type max_size() const noexcept
@@ -222,12 +418,67 @@ public:
 
     bool empty() const noexcept
     {
-        return (size() == 0);
+        return (beforeHead.xorPtr == reinterpret_cast<PtrInteger>(::std::addressof(afterTail)));
+    }
+
+    // Number of elements the list can hold without allocations: its size plus the cached nodes
+    size_type capacity() const noexcept
+    {
+        return size() + cachedCount;
+    }
+
+    // Allocates nodes for n elements in advance
+    // Also makes erase/pop_*/clear keep up to (n - size()) retired nodes for reuse instead of freeing them,
+    //  so a list with a steady size doesn't touch the allocator
+    // The elements aren't touched if an exception is thrown
+    void reserve(size_type n)
+    {
+        const size_type thisSize = size();
+        if (n <= thisSize)
+        {
+            return;
+        }
+
+        const size_type required = n - thisSize;
+        if (cacheCapacity < required)
+        {
+            cacheCapacity = required;
+        }
+
+        while (cachedCount < required)
+        {
+            cacheNode(::std::allocator_traits<NodeAllocator>::allocate(allocator, 1));
+        }
+    }
+
+    // Frees the cached nodes and turns the cache off (see reserve())
+    void shrink_to_fit() noexcept
+    {
+        releaseCache();
+        cacheCapacity = 0;
+    }
+
+    // Relays the nodes out in traversal order, so iterating the list becomes a sequential memory scan
+    // Pooled allocators keep the nodes: the elements are moved between them to follow the node addresses
+    //  (T must be nothrow movable, otherwise the generic way is used)
+    // Otherwise the elements are moved into fresh nodes and the old ones are freed
+    //  (monotonic allocators take all the fresh nodes from one allocation and keep the old ones until reset)
+    // WARNING! All iterators, pointers and references will become invalid
+    // strong exception-safe guarantee
+    void compact()
+    {
+        if (!hasLessThanTwoElements())
+        {
+            compactImpl();
+        }
     }
 
+    // With a monotonic allocator nodes aren't deallocated one by one:
+    //  destructors run only for non-trivially destructible T, then the arena is reset if this list is its only user
+    // Complexity: O(1) for trivially destructible T and monotonic allocator, O(n) otherwise
     void clear()
     {
-        destroySequence(cbegin(), cend(), size());
+        clearImpl();
     }
 
     T& back()
@@ -281,6 +532,31 @@ public:
         return { reinterpret_cast<Node*>(afterTail.xorPtr), &afterTail };
     }
 
+    // Calls f for each element in order like ::std::for_each, but prefetches the next node while f runs
+    template<typename UnaryFunction>
+    UnaryFunction for_each(UnaryFunction f)
+    {
+        for (auto iter = begin(); iter != end(); ++iter)
+        {
+            Sequences::prefetchNext(iter);
+            f(*iter);
+        }
+
+        return f;
+    }
+
+    template<typename UnaryFunction>
+    UnaryFunction for_each(UnaryFunction f) const
+    {
+        for (auto iter = cbegin(); iter != cend(); ++iter)
+        {
+            Sequences::prefetchNext(iter);
+            f(*iter);
+        }
+
+        return f;
+    }
+
     void sort()
     {
         sort(::std::less<T>{});
@@ -289,184 +565,532 @@ public:
     template<typename Compare>
     void sort(Compare isLess)
     {
-        using Range = ::std::pair<const_iterator, const_iterator>;
-        struct NullableRange
-        {
-            Range range;
-            bool isNull = true;
-        };
-
-
-        const auto thisSize = size();
+        sort(::std::move(isLess), XOR_LIST_SORT_BUFFER_THRESHOLD);
+    }
 
-        if (thisSize < 2)
+    // Stable in both modes
+    // Lists with at least bufferThreshold elements gather pointers to their nodes into a temporary array,
+    //  sort it and relink the nodes in one pass: the array sort doesn't chase links between comparisons.
+    //  Takes one extra pointer per element, falls back to the merge sort of the nodes if it can't be allocated
+    // Smaller lists are merge sorted by relinking the nodes, taking O(1) extra memory
+    // If isLess throws, the list keeps all its elements in unspecified order
+    template<typename Compare>
+    void sort(Compare isLess, size_type bufferThreshold)
+    {
+        if (hasLessThanTwoElements())
         {
             return;
         }
 
-        ::std::array<NullableRange, 32> sortedRanges;
-
-        while (!empty())
+        if (hasAtLeast(bufferThreshold) && sortThroughBuffer(isLess))
         {
-            Range newRange = cutSequenceFromThis(cbegin(), ++cbegin(), 1).cutted;
+            return;
+        }
 
-            ::std::uint32_t i = 0;
-            for ( ; i < sortedRanges.size(); ++i)
-            {
-                if (sortedRanges[i].isNull)
-                {
-                    sortedRanges[i].range = newRange;
-                    sortedRanges[i].isNull = false;
-                    break;
-                }
-                else
-                {
-                    newRange = mergeSequences(sortedRanges[i].range.first, sortedRanges[i].range.second,
-                                              newRange.first, newRange.second, isLess);
-                    sortedRanges[i].isNull = true;
-                }
-            }
+        const auto thisSize = trackedSize();
+        typename Sequences::Range sequence = cutSequenceFromThis(cbegin(), cend(), thisSize).cutted;
 
-            if (i == sortedRanges.size())
-            {
-                sortedRanges.back().range = newRange;
-                sortedRanges.back().isNull = false;
-            }
+        try
+        {
+            Sequences::sortSequence(sequence, isLess);
         }
-
-        NullableRange result;
-        for (::std::uint32_t i = 0; i < sortedRanges.size(); ++i)
+        catch (...)
         {
-            if (!sortedRanges[i].isNull)
-            {
-                if (result.isNull)
-                {
-                    result = sortedRanges[i];
-                }
-                else
-                {
-                    result.range = mergeSequences(sortedRanges[i].range.first, sortedRanges[i].range.second,
-                                                  result.range.first, result.range.second, isLess);
-                }
-            }
+            (void)insertSequenceToThisBefore(cend(), sequence.first, sequence.second, thisSize);
+            throw;
         }
 
-        (void)insertSequenceToThisBefore(cend(), result.range.first, result.range.second, thisSize);
+        (void)insertSequenceToThisBefore(cend(), sequence.first, sequence.second, thisSize);
     }
 
-    // WARNING! Iterators equal to position will become invalid
-    // strong exception-safe guarantee
-    iterator insert(const_iterator position, const_reference val)
+    template<typename KeyFunction>
+    void sort_by_key(KeyFunction key)
     {
-        return emplace(position, val);
+        using Key = typename ::std::decay<decltype(key(::std::declval<const T&>()))>::type;
+
+        sort_by_key(::std::move(key), ::std::less<Key>{});
     }
 
-    // WARNING! Iterators equal to position will become invalid
-    // strong exception-safe guarantee
-    template<typename InputIterator>
-    iterator insert(const_iterator position, InputIterator first, InputIterator last)
+    // Stable sort by key(element) for comparators that would compute the same keys again and again:
+    //  key is called once per element, the (key, node) pairs are sorted in a temporary array
+    //  and the nodes are relinked in one pass
+    // Takes a key, a node pointer and an index per element
+    // The list isn't changed if key, keyLess or the allocation throw
+    template<typename KeyFunction, typename KeyCompare>
+    void sort_by_key(KeyFunction key, KeyCompare keyLess)
     {
-        if (first == last)
+        using Key = typename ::std::decay<decltype(key(::std::declval<const T&>()))>::type;
+
+        struct Entry
         {
-            return static_cast<iterator>(position);
+            Key key;
+            // The initial position breaks ties, so the unstable array sort is stable here
+            size_type index;
+            NodeWithValue *node;
+        };
+
+        using EntryAllocator = typename ::std::allocator_traits<NodeAllocator>::template rebind_alloc<Entry>;
+
+        if (hasLessThanTwoElements())
+        {
+            return;
         }
 
-        const iterator result = insert(position, *first);
-        position = result;
-        size_type insertedCount = 1;
+        ::std::vector<Entry, EntryAllocator> entries(EntryAllocator{ allocator });
+        entries.reserve(size());
 
-        for (++position ; ++first != last; ++position, ++insertedCount)
+        for (auto iter = cbegin(); iter != cend(); ++iter)
         {
-            try
+            Sequences::prefetchNext(iter);
+
+            NodeWithValue *const node = static_cast<NodeWithValue*>(iter.current);
+            entries.push_back({ key(node->value), entries.size(), node });
+        }
+
+        ::std::sort(entries.begin(), entries.end(), [&keyLess](const Entry &left, const Entry &right)
+        {
+            if (keyLess(left.key, right.key))
             {
-                position = insert(position, *first);
+                return true;
             }
-            catch(...)
+            if (keyLess(right.key, left.key))
             {
-                destroySequence(result, position, insertedCount);
-                throw;
+                return false;
             }
-        }
 
-        return result;
+            return (left.index < right.index);
+        });
+
+        linkInOrder(entries, [](const Entry &entry)
+        {
+            return entry.node;
+        });
     }
 
-    // WARNING! Iterators equal to position will become invalid
-    // strong exception-safe guarantee
-    template<typename... Args>
-    iterator emplace(const_iterator position, Args&&... args)
+    iterator partial_sort(size_type k)
     {
-        //insertNodeToThisBefore noexcept!
-        return insertNodeToThisBefore(position, createNode(::std::forward<Args>(args)...)).first;
+        return partial_sort(k, ::std::less<T>{});
     }
 
-    // WARNING! All iterators will become invalid
-    // Complexity: O(1)
-    void reverse() noexcept
+    // Moves the k smallest elements to the front in sorted order, the rest keep their order after them
+    // Stable: equal elements keep their initial order
+    // One pass keeps a heap of the k smallest nodes so far (a node pointer and an index each),
+    //  then the chosen nodes are relinked: O(n log k) comparisons, about n when k is much less than n
+    // Returns the iterator after the sorted part
+    // The list isn't changed if isLess or the allocation throw, unless the whole list is sorted (k >= size())
+    // WARNING! Iterators to the moved elements and to their neighbours will become invalid
+    template<typename Compare>
+    iterator partial_sort(size_type k, Compare isLess)
     {
-        if (empty())
+        if (k == 0)
         {
-            return;
+            return begin();
         }
 
-        auto first = cbegin();
-        auto last = --cend();
-
-        first.current->xorPtr = xorPointers(xorPointers(first.current->xorPtr, ::std::addressof(beforeHead)),
-                                            ::std::addressof(afterTail));
-        last.current->xorPtr = xorPointers(xorPointers(last.current->xorPtr, ::std::addressof(afterTail)),
-                                           ::std::addressof(beforeHead));
+        if (!hasMoreThan(k))
+        {
+            sort(::std::move(isLess));
+            return end();
+        }
 
-        beforeHead.xorPtr = reinterpret_cast<PtrInteger>(last.current);
-        afterTail.xorPtr = reinterpret_cast<PtrInteger>(first.current);
+        return ::std::next(selectSmallest(k, isLess));
     }
 
-    // WARNING! Iterators in the range [position, position + 1] will become invalid
-    iterator erase(const_iterator position)
+    iterator nth_element(size_type n)
     {
-        return erase(position, ::std::next(position));
+        return nth_element(n, ::std::less<T>{});
     }
 
-    // WARNING! Iterators in the range [first, last] will become invalid
-    iterator erase(const_iterator first, const_iterator last)
+    // Puts the element which would be at position n in the sorted list there, like ::std::nth_element
+    // The elements before it are sorted too (see partial_sort), the rest keep their order
+    // Returns the iterator to the n-th element or end() if n >= size()
+    // Complexity: O(size() log n) comparisons, the heap holds n + 1 nodes
+    template<typename Compare>
+    iterator nth_element(size_type n, Compare isLess)
     {
-        if (first != last)
+        if (!hasMoreThan(n))
         {
-            destroySequence(first, last, ::std::distance(first, last));
+            return end();
         }
 
-        return { first.prev, last.current };
+        // n + 1 can't overflow: there are more than n elements
+        if (!hasMoreThan(n + 1))
+        {
+            sort(::std::move(isLess));
+            return --end();
+        }
+
+        return selectSmallest(n + 1, isLess);
     }
 
-    size_type remove(const T &value)
+    void sort(const xor_list_parallel_policy &policy)
     {
-        return remove_if([&value](const T &elem) { return (elem == value); });
+        sort(policy, ::std::less<T>{});
     }
 
-    template<typename UnaryPredicate>
-    size_type remove_if(UnaryPredicate p)
+    // Stable
+    // Cuts the list into a chunk per thread, merge sorts the chunks concurrently,
+    //  then merges them pairwise, the pairs of each round concurrently
+    // Each thread takes its own copy of isLess
+    // isLess must not throw: like with the standard parallel algorithms, an exception terminates the program
+    template<typename Compare>
+    void sort(const xor_list_parallel_policy &policy, Compare isLess)
     {
-        size_type result = 0;
-
-        for (const_iterator iter = cbegin(); iter != cend();)
+        if (hasLessThanTwoElements())
         {
-            if (p(*iter))
-            {
-                iter = erase(iter);
-                ++result;
-            }
-            else
-            {
-                ++iter;
-            }
+            return;
         }
 
-        return result;
-    }
+        const size_type thisSize = size();
+        const size_type threadCount = (policy.threads > 0) ? policy.threads : ::std::thread::hardware_concurrency();
+        const size_type chunkCount = ::std::min(threadCount, thisSize / minParallelSortChunk);
 
-    void resize(size_type count)
-    {
-        resizeImpl(count);
+        if (chunkCount < 2)
+        {
+            sort(::std::move(isLess));
+            return;
+        }
+
+        using Range = ::std::pair<const_iterator, const_iterator>;
+
+        // Everything is allocated before the list is touched
+        ::std::vector<Range> chunks;
+        ::std::vector<::std::thread> threads;
+        chunks.reserve(chunkCount);
+        threads.reserve(chunkCount - 1);
+
+        Range rest = cutSequenceFromThis(cbegin(), cend(), thisSize).cutted;
+        for (size_type i = 1; i < chunkCount; ++i)
+        {
+            const auto cutResult = Sequences::cutSequence(rest.first, ::std::next(rest.first, thisSize / chunkCount));
+
+            chunks.push_back(cutResult.cutted);
+            rest.first = cutResult.end;
+        }
+        chunks.push_back(rest);
+
+        runConcurrently(threads, chunks.size(), [&chunks, &isLess](const size_type i)
+        {
+            Compare threadIsLess(isLess);
+            Sequences::sortSequence(chunks[i], threadIsLess);
+        });
+
+        // Each right chunk is merged into the chunk on its left, which keeps equal elements first: the sort stays stable
+        while (chunks.size() > 1)
+        {
+            runConcurrently(threads, chunks.size() / 2, [&chunks, &isLess](const size_type i)
+            {
+                Compare threadIsLess(isLess);
+                chunks[2 * i] = Sequences::mergeSequences(chunks[2 * i].first, chunks[2 * i].second,
+                                                          chunks[2 * i + 1].first, chunks[2 * i + 1].second,
+                                                          threadIsLess);
+            });
+
+            for (size_type i = 0; 2 * i < chunks.size(); ++i)
+            {
+                chunks[i] = chunks[2 * i];
+            }
+            chunks.resize((chunks.size() + 1) / 2);
+        }
+
+        (void)insertSequenceToThisBefore(cend(), chunks.front().first, chunks.front().second, thisSize);
+    }
+
+    // Stable LSD radix sort of integral elements, negative values first
+    template<typename U = T>
+    typename ::std::enable_if<::std::is_integral<U>::value && !::std::is_same<U, bool>::value>::type
+    radix_sort()
+    {
+        radix_sort(xor_list_detail::IntegralKey<T>{});
+    }
+
+    // Stable LSD radix sort by an unsigned integer key of the elements, a byte per pass
+    // The nodes are distributed into 256 buckets by relinking: nothing is allocated or copied
+    // Bytes that are equal in all the keys are skipped
+    // Complexity: O(n) per differing key byte, plus one pass to find them
+    // The order of the elements is unspecified if key throws
+    template<typename KeyFunction>
+    void radix_sort(KeyFunction key)
+    {
+        using Key = typename ::std::decay<decltype(key(::std::declval<const T&>()))>::type;
+        static_assert(::std::is_integral<Key>::value && ::std::is_unsigned<Key>::value,
+                      "Radix sort key must be an unsigned integer");
+
+        if (hasLessThanTwoElements())
+        {
+            return;
+        }
+
+        const Key firstKey = key(front());
+        Key differingBits = 0;
+        for (auto iter = cbegin(); iter != cend(); ++iter)
+        {
+            Sequences::prefetchNext(iter);
+            differingBits |= static_cast<Key>(key(*iter) ^ firstKey);
+        }
+
+        const auto thisSize = trackedSize();
+        auto sequence = cutSequenceFromThis(cbegin(), cend(), thisSize).cutted;
+
+        try
+        {
+            for (int shift = 0; shift < ::std::numeric_limits<Key>::digits; shift += radixBits)
+            {
+                if (((differingBits >> shift) & (radixBuckets - 1)) != 0)
+                {
+                    distributeSequence(sequence, key, shift);
+                }
+            }
+        }
+        catch (...)
+        {
+            (void)insertSequenceToThisBefore(cend(), sequence.first, sequence.second, thisSize);
+            throw;
+        }
+
+        (void)insertSequenceToThisBefore(cend(), sequence.first, sequence.second, thisSize);
+    }
+
+    // WARNING! Iterators equal to position will become invalid
+    // strong exception-safe guarantee
+    iterator insert(const_iterator position, const_reference val)
+    {
+        return emplace(position, val);
+    }
+
+    // WARNING! Iterators equal to position will become invalid
+    // strong exception-safe guarantee
+    template<typename InputIterator>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last)
+    {
+        return insertRange(position, first, last,
+                           typename ::std::iterator_traits<InputIterator>::iterator_category{});
+    }
+
+    // Same as above, but count must be the number of elements in [first, last), so the range isn't walked twice
+    //  and input iterators are inserted at once too
+    // WARNING! Iterators equal to position will become invalid
+    // strong exception-safe guarantee
+    template<typename InputIterator>
+    iterator insert(const_iterator position, InputIterator first, InputIterator /*last*/, size_type count)
+    {
+        return insertCounted(position, first, count);
+    }
+
+    // WARNING! Iterators equal to position will become invalid
+    // strong exception-safe guarantee
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+        //insertNodeToThisBefore noexcept!
+        return insertNodeToThisBefore(position, createNode(::std::forward<Args>(args)...)).first;
+    }
+
+    // WARNING! All iterators will become invalid
+    // Complexity: O(1)
+    void reverse() noexcept
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        auto first = cbegin();
+        auto last = --cend();
+
+        using xor_list_detail::xorPointers;
+
+        first.current->xorPtr = xorPointers(xorPointers(first.current->xorPtr, ::std::addressof(beforeHead)),
+                                            ::std::addressof(afterTail));
+        last.current->xorPtr = xorPointers(xorPointers(last.current->xorPtr, ::std::addressof(afterTail)),
+                                           ::std::addressof(beforeHead));
+
+        beforeHead.xorPtr = reinterpret_cast<PtrInteger>(last.current);
+        afterTail.xorPtr = reinterpret_cast<PtrInteger>(first.current);
+    }
+
+    // Reverses [first, last) of this list, returns the reversed range
+    // WARNING! Iterators to the elements of [first, last] will become invalid
+    // Complexity: O(1)
+    ::std::pair<iterator, iterator> reverse(const_iterator first, const_iterator last) noexcept
+    {
+        return Sequences::reverseSequence(first, last);
+    }
+
+    // Makes new_first the first element keeping the cyclic order, like ::std::rotate(begin(), new_first, end())
+    // Returns an iterator to the element that was the first one
+    // WARNING! Iterators to the first and the last elements, equal to new_first and end() will become invalid
+    // Complexity: O(1)
+    iterator rotate(const_iterator new_first) noexcept
+    {
+        if (new_first == cbegin())
+        {
+            return end();
+        }
+        if (new_first == cend())
+        {
+            return begin();
+        }
+
+        const auto cutResult = Sequences::cutSequence(cbegin(), new_first);
+        return Sequences::insertSequenceBefore(cend(), cutResult.cutted.first, cutResult.cutted.second).first;
+    }
+
+    // WARNING! Iterators in the range [position, position + 1] will become invalid
+    iterator erase(const_iterator position)
+    {
+        return erase(position, ::std::next(position), 1);
+    }
+
+    // WARNING! Iterators in the range [first, last] will become invalid
+    // The elements are counted while being destroyed
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        (void)destroySequence(first, last);
+
+        return { first.prev, last.current };
+    }
+
+    // Same as above, but count must be the number of elements in [first, last)
+    // WARNING! Iterators in the range [first, last] will become invalid
+    iterator erase(const_iterator first, const_iterator last, size_type count)
+    {
+        destroySequence(first, last, count);
+
+        return { first.prev, last.current };
+    }
+
+    size_type remove(const T &value)
+    {
+        return remove_if([&value](const T &elem) { return (elem == value); });
+    }
+
+    template<typename UnaryPredicate>
+    size_type remove_if(UnaryPredicate p)
+    {
+        size_type result = 0;
+
+        for (const_iterator iter = cbegin(); iter != cend();)
+        {
+            Sequences::prefetchNext(iter);
+
+            if (p(*iter))
+            {
+                iter = erase(iter);
+                ++result;
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return result;
+    }
+
+    // Same as stable_partition(): relinking keeps the order for free, so there's no faster unstable way
+    template<typename UnaryPredicate>
+    iterator partition(UnaryPredicate p)
+    {
+        return stable_partition(::std::move(p));
+    }
+
+    // Moves the elements for which p returns false after the others, keeping the order within both groups
+    // The nodes are relinked into two detached sequences: nothing is copied, moved or allocated
+    // The list is walked from both ends at once, so the loads of the next nodes on the two sides overlap
+    // p is called once per element, in an unspecified order
+    // Returns the iterator to the first element of the second group or end()
+    // If p throws, the elements are left in an unspecified order
+    // All iterators will become invalid
+    template<typename UnaryPredicate>
+    iterator stable_partition(UnaryPredicate p)
+    {
+        if (empty())
+        {
+            return end();
+        }
+
+        // The size doesn't change, so the elements aren't counted
+        const auto range = Sequences::cutSequence(cbegin(), cend()).cutted;
+
+        // The front side appends its nodes, the back side prepends them
+        DetachedChain frontAccepted, frontRejected, backAccepted, backRejected;
+
+        Node *frontPrev = nullptr;
+        Node *front = range.first.current;
+        Node *backNext = nullptr;
+        Node *back = range.second.prev;
+
+        try
+        {
+            // [front, back] is still linked as it was
+            while (front != backNext)
+            {
+                Node *const frontNext = reinterpret_cast<Node*>(xor_list_detail::xorPointers(frontPrev, front->xorPtr));
+                xor_list_detail::prefetch(frontNext);
+
+                if (p(static_cast<NodeWithValue*>(front)->value))
+                {
+                    frontAccepted.append(front);
+                }
+                else
+                {
+                    frontRejected.append(front);
+                }
+                frontPrev = front;
+                front = frontNext;
+
+                if (front == backNext)
+                {
+                    break;
+                }
+
+                Node *const backPrev = reinterpret_cast<Node*>(xor_list_detail::xorPointers(backNext, back->xorPtr));
+                xor_list_detail::prefetch(backPrev);
+
+                if (p(static_cast<NodeWithValue*>(back)->value))
+                {
+                    backAccepted.prepend(back);
+                }
+                else
+                {
+                    backRejected.prepend(back);
+                }
+                backNext = back;
+                back = backPrev;
+            }
+        }
+        catch (...)
+        {
+            if (front != backNext)
+            {
+                front->xorPtr = xor_list_detail::xorPointers(front->xorPtr, frontPrev);
+                back->xorPtr = xor_list_detail::xorPointers(back->xorPtr, backNext);
+                frontAccepted.append(DetachedChain(front, back));
+            }
+
+            frontAccepted.append(backAccepted);
+            frontAccepted.append(frontRejected);
+            frontAccepted.append(backRejected);
+            (void)Sequences::insertSequenceBefore(cend(), { nullptr, frontAccepted.first }, { frontAccepted.last, nullptr });
+            throw;
+        }
+
+        frontAccepted.append(backAccepted);
+        frontRejected.append(backRejected);
+
+        Node *const acceptedLast = (frontAccepted.last != nullptr) ? frontAccepted.last : ::std::addressof(beforeHead);
+        Node *const rejectedFirst = frontRejected.first;
+
+        frontAccepted.append(frontRejected);
+        (void)Sequences::insertSequenceBefore(cend(), { nullptr, frontAccepted.first }, { frontAccepted.last, nullptr });
+
+        return (rejectedFirst != nullptr) ? iterator{ acceptedLast, rejectedFirst } : end();
+    }
+
+    void resize(size_type count)
+    {
+        resizeImpl(count);
     }
 
     void resize(size_type count, const_reference val)
@@ -487,13 +1111,11 @@ public:
                 return;
             }
 
+            Sequences::prefetchNext(iter);
             *iter = *first;
         }
 
-        for ( ; first != last; ++first)
-        {
-            emplace_back(*first);
-        }
+        (void)insert(cend(), first, last);
     }
 
     void assign(size_type count, const_reference val)
@@ -501,6 +1123,7 @@ public:
         auto iter = begin();
         for ( ; (iter != end()) && (count > 0); ++iter, --count)
         {
+           Sequences::prefetchNext(iter);
            *iter = val;
         }
 
@@ -510,11 +1133,10 @@ public:
         }
         else
         {
-            while (count > 0)
+            (void)insertConstructed(cend(), count, [this, &val](NodeWithValue *const node)
             {
-                emplace_back(val);
-                --count;
-            }
+                ::std::allocator_traits<NodeAllocator>::construct(allocator, node, val);
+            });
         }
     }
 
@@ -531,7 +1153,7 @@ public:
             return;
         }
 
-        const auto distance = x.size();
+        const auto distance = x.trackedSize();
         const auto range = x.cutSequenceFromThis(x.cbegin(), x.cend(), distance).cutted;
 
         (void)insertSequenceToThisBefore(position, range.first, range.second, distance);
@@ -548,6 +1170,7 @@ public:
         (void)insertNodeToThisBefore(position, static_cast<NodeWithValue*>(range.first.current));
     }
 
+    // Complexity: O(1) if this == &x or with xor_list_untracked_size, O(distance(first, last)) otherwise
     void splice(const_iterator position, xor_list &x, const_iterator first, const_iterator last)
     {
         if (first == last)
@@ -555,10 +1178,64 @@ public:
             return;
         }
 
-        const size_type distance = (this == ::std::addressof(x)) ? size() : ::std::distance(first, last);
+        // The length of *this doesn't change, so any number will do
+        const size_type distance = (this == ::std::addressof(x)) ? 0 : trackedDistance(first, last);
+
+        splice(position, x, first, last, distance);
+    }
+
+    // Same as above, but count must be the number of elements in [first, last)
+    // Complexity: O(1)
+    void splice(const_iterator position, xor_list &x, const_iterator first, const_iterator last, size_type count)
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        ::std::tie(first, last) = x.cutSequenceFromThis(first, last, count).cutted;
+        (void)insertSequenceToThisBefore(position, first, last, count);
+    }
+
+    // Moves [position, end()) into the returned list, which uses a copy of the allocator of *this
+    // WARNING! Iterators to the first and the last moved elements and end() will become invalid
+    // Complexity: O(1) with xor_list_untracked_size, O(distance(position, end())) otherwise
+    xor_list split(const_iterator position)
+    {
+        return split(position, trackedDistance(position, cend()));
+    }
+
+    // Same as above, but count must be the number of elements in [position, end())
+    // Complexity: O(1)
+    xor_list split(const_iterator position, size_type count)
+    {
+        xor_list tail(get_allocator());
+
+        if (position != cend())
+        {
+            const auto range = cutSequenceFromThis(position, cend(), count).cutted;
+            (void)tail.insertSequenceToThisBefore(tail.cend(), range.first, range.second, count);
+        }
+
+        return tail;
+    }
+
+    // Appends the elements of the lists in the given order, the lists become empty
+    // nullptr and this are skipped
+    // Complexity: O(number of lists)
+    void concat(::std::initializer_list<xor_list*> lists) noexcept
+    {
+        for (xor_list *const list : lists)
+        {
+            if ((list == nullptr) || (list == this) || (list->empty()))
+            {
+                continue;
+            }
 
-        ::std::tie(first, last) = x.cutSequenceFromThis(first, last, distance).cutted;
-        (void)insertSequenceToThisBefore(position, first, last, distance);
+            const auto count = list->trackedSize();
+            const auto range = list->cutSequenceFromThis(list->cbegin(), list->cend(), count).cutted;
+            (void)insertSequenceToThisBefore(cend(), range.first, range.second, count);
+        }
     }
 
     // All iterators will become invalid
@@ -571,7 +1248,7 @@ public:
     template<typename BinaryPredicate>
     void unique(BinaryPredicate isEqual)
     {
-        if (size() < 2)
+        if (hasLessThanTwoElements())
         {
             return;
         }
@@ -579,6 +1256,8 @@ public:
         auto current = cbegin();
         for (auto prev = current++; current != cend(); )
         {
+            Sequences::prefetchNext(current);
+
             if (isEqual(*prev, *current))
             {
                 current = erase(current);
@@ -602,53 +1281,225 @@ public:
     {
         if (!x.empty())
         {
-            const auto distance = x.size();
+            const auto distance = x.trackedSize();
             const auto range = x.cutSequenceFromThis(x.cbegin(), x.cend(), distance).cutted;
 
             (void)mergeSequencesToThis(cbegin(), cend(), range.first, range.second, ::std::move(isLess), distance);
         }
     }
 
-private:
-    template<bool c, typename TrueType, typename FalseType>
-    using Cond = typename ::std::conditional<c, TrueType, FalseType>::type;
+    template<typename ListIterator>
+    void merge_all(ListIterator first, ListIterator last)
+    {
+        merge_all(first, last, ::std::less<T>{});
+    }
 
-    struct NodeWithValue;
+    // Merges the sorted lists of the forward range [first, last) into *this in one pass, the lists become empty
+    // Stable: equal elements go in the order of *this, then of the lists in the range
+    // K-way merge through a binary heap of the list heads: O(n log k) comparisons,
+    //  the nodes are relinked directly and only the heap of k entries is allocated
+    // If isLess throws, the elements are left in *this in an unspecified order
+    // All iterators from *this and the lists in the range will become invalid
+    template<typename ListIterator, typename Compare>
+    void merge_all(ListIterator first, ListIterator last, Compare isLess)
+    {
+        using CursorAllocator = typename ::std::allocator_traits<NodeAllocator>::template rebind_alloc<MergeCursor>;
 
+        ::std::vector<MergeCursor, CursorAllocator> heap(CursorAllocator{ allocator });
+        heap.reserve(1 + static_cast<size_type>(::std::distance(first, last)));
 
-    static_assert((sizeof(Node*) == 1) || (sizeof(Node*) == 2)
-                  || (sizeof(Node*) == 4) || (sizeof(Node*) == 8), "Invalid sizeof pointer");
+        size_type moved = 0;
+        takeMergeCursor(*this, heap, moved);
+        for (; first != last; ++first)
+        {
+            if (::std::addressof(*first) != this)
+            {
+                takeMergeCursor(*first, heap, moved);
+            }
+        }
 
-    static_assert(sizeof(NodeWithValue*) == sizeof(Node*), "Invalid sizeof pointer");
+        // The heap entries are the remaining parts of the detached sequences, the output is one more
+        Node *outFirst = nullptr;
+        Node *outLast = nullptr;
 
-    using PtrInteger = Cond<sizeof(Node*) == 1,
-                            ::std::uint8_t,
-                            Cond<sizeof(Node*) == 2,
-                                 ::std::uint16_t,
-                                 Cond<sizeof(Node*) == 4,
-                                      ::std::uint32_t,
-                                      ::std::uint64_t> > >;
+        try
+        {
+            for (size_type i = heap.size() / 2; i > 0; --i)
+            {
+                siftMergeCursor(heap, i - 1, isLess);
+            }
 
+            while (heap.size() > 1)
+            {
+                MergeCursor &top = heap.front();
+
+                Node *const node = top.current;
+                Node *const next = reinterpret_cast<Node*>(xor_list_detail::xorPointers(top.prev, node->xorPtr));
+                xor_list_detail::prefetch(next);
+
+                node->xorPtr = reinterpret_cast<PtrInteger>(outLast);
+                if (outLast == nullptr)
+                {
+                    outFirst = node;
+                }
+                else
+                {
+                    outLast->xorPtr = xor_list_detail::xorPointers(outLast->xorPtr, node);
+                }
+                outLast = node;
+
+                top.prev = node;
+                top.current = next;
+                if (next == nullptr)
+                {
+                    top = heap.back();
+                    heap.pop_back();
+                }
+
+                siftMergeCursor(heap, 0, isLess);
+            }
+        }
+        catch (...)
+        {
+            linkMergeRemains(heap, outFirst, outLast, moved);
+            throw;
+        }
+
+        // The last list left is taken at once
+        linkMergeRemains(heap, outFirst, outLast, moved);
+    }
 
-    struct Node
+    size_type merge_unique(xor_list &x)
     {
-        PtrInteger xorPtr;
+        return merge_unique(x, ::std::less<T>{});
+    }
+
+    // Merges the sorted list x into *this like ::std::set_union: an element of x equal to a not yet matched
+    //  element of *this is dropped, the others are relinked into *this. x becomes empty
+    // Allocates nothing, the dropped nodes are freed at once in the end
+    // Returns the number of the dropped elements
+    // If isLess throws, the elements of x not taken yet stay in x
+    // All iterators from *this and x will become invalid
+    template<typename Compare>
+    size_type merge_unique(xor_list &x, Compare isLess)
+    {
+        if (this == ::std::addressof(x))
+        {
+            return 0;
+        }
 
+        DetachedChain dropped;
+        size_type droppedCount = 0;
 
-        explicit Node(Node *xorPtr = nullptr)
-            : xorPtr(reinterpret_cast<PtrInteger>(xorPtr))
-        {}
+        try
+        {
+            for (auto iter = cbegin(); (iter != cend()) && !x.empty(); )
+            {
+                Sequences::prefetchNext(iter);
 
-        Node(const Node&) noexcept = default;
-        Node(Node &&) noexcept = default;
+                const auto other = x.cbegin();
+                if (isLess(*iter, *other))
+                {
+                    ++iter;
+                }
+                else if (isLess(*other, *iter))
+                {
+                    // The elements of x less than *iter go before it together
+                    size_type count = 1;
+                    auto runEnd = ::std::next(other);
+                    for (; (runEnd != x.cend()) && isLess(*runEnd, *iter); ++runEnd)
+                    {
+                        Sequences::prefetchNext(runEnd);
+                        ++count;
+                    }
+
+                    const auto run = x.cutSequenceFromThis(other, runEnd, count).cutted;
+                    iter = insertSequenceToThisBefore(iter, run.first, run.second, count).second;
+                }
+                else
+                {
+                    dropped.append(x.cutSequenceFromThis(other, ::std::next(other), 1).cutted.first.current);
+                    ++droppedCount;
+                    ++iter;
+                }
+            }
+        }
+        catch (...)
+        {
+            freeDropped(dropped, droppedCount);
+            throw;
+        }
 
-        virtual ~Node() = default;
+        splice(cend(), x);
+        freeDropped(dropped, droppedCount);
 
-        Node& operator=(const Node&) noexcept = default;
-        Node& operator=(Node &&) noexcept = default;
-    };
+        return droppedCount;
+    }
+
+    size_type intersect(const xor_list &other)
+    {
+        return intersect(other, ::std::less<T>{});
+    }
+
+    // Keeps the elements of the sorted *this which are found in the sorted list other, like ::std::set_intersection:
+    //  each element of other matches one equal element. other isn't changed
+    // Allocates nothing, the erased nodes are freed at once in the end
+    // Returns the number of the erased elements
+    // If isLess throws, some of the elements to erase may stay
+    // WARNING! Iterators to the erased elements and to their neighbours will become invalid
+    template<typename Compare>
+    size_type intersect(const xor_list &other, Compare isLess)
+    {
+        if (this == ::std::addressof(other))
+        {
+            return 0;
+        }
+
+        return eraseByMatches(other, isLess, true);
+    }
+
+    size_type subtract(const xor_list &other)
+    {
+        return subtract(other, ::std::less<T>{});
+    }
+
+    // Erases the elements of the sorted *this which are found in the sorted list other, like ::std::set_difference:
+    //  each element of other matches one equal element. other isn't changed
+    // Allocates nothing, the erased nodes are freed at once in the end
+    // Returns the number of the erased elements
+    // If isLess throws, some of the elements to erase may stay
+    // WARNING! Iterators to the erased elements and to their neighbours will become invalid
+    template<typename Compare>
+    size_type subtract(const xor_list &other, Compare isLess)
+    {
+        if (this == ::std::addressof(other))
+        {
+            const size_type erased = size();
+            clear();
+            return erased;
+        }
+
+        return eraseByMatches(other, isLess, false);
+    }
+
+private:
+    template<typename U, class A, class S>
+    friend bool operator==(const xor_list<U, A, S> &lhs, const xor_list<U, A, S> &rhs);
+    template<typename U, class A, class S>
+    friend bool operator<(const xor_list<U, A, S> &lhs, const xor_list<U, A, S> &rhs);
+
+
+    using PtrInteger = xor_list_detail::PtrInteger;
+    using Sequences = xor_list_detail::Sequences<iterator, const_iterator>;
+    using CutResult = typename Sequences::CutResult;
 
-    struct NodeWithValue final : Node
+    struct NodeWithValue;
+
+
+    static_assert(sizeof(NodeWithValue*) == sizeof(Node*), "Invalid sizeof pointer");
+
+
+    struct NodeWithValue : Node
     {
         T value;
 
@@ -662,12 +1513,19 @@ private:
         NodeWithValue(const NodeWithValue&) = delete;
         NodeWithValue(NodeWithValue &&) = delete;
 
-        ~NodeWithValue() override = default;
+        ~NodeWithValue() = default;
 
         NodeWithValue& operator=(const NodeWithValue&) = delete;
         NodeWithValue& operator=(NodeWithValue &&) = delete;
     };
 
+    // Reference layout for NodeWithValue: the XOR link immediately followed by the value
+    struct NodeLayout
+    {
+        PtrInteger xorPtr;
+        T value;
+    };
+
 
     #ifdef _MSC_VER
     using NodeAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<NodeWithValue>;
@@ -695,7 +1553,7 @@ private:
 
         It& operator++()
         {
-            Node *next = reinterpret_cast<Node*>(xorPointers(prev, current->xorPtr));
+            Node *next = reinterpret_cast<Node*>(xor_list_detail::xorPointers(prev, current->xorPtr));
 
             prev = current;
             current = next;
@@ -731,7 +1589,7 @@ private:
         // ===================== Bidirectional Iterator Concept =======================
         It& operator--()
         {
-            Node *newPrev = reinterpret_cast<Node*>(xorPointers(prev->xorPtr, current));
+            Node *newPrev = reinterpret_cast<Node*>(xor_list_detail::xorPointers(prev->xorPtr, current));
 
             current = prev;
             prev = newPrev;
@@ -765,273 +1623,1337 @@ private:
         IteratorBase& operator=(IteratorBase&&) noexcept = default;
 
     private:
-        friend class xor_list<T, TAllocator>;
+        friend class xor_list<T, TAllocator, SizePolicy>;
+        friend struct xor_list_detail::Sequences<iterator, const_iterator>;
     };
 
 
-    struct CutResult final
+    // Head of a detached sequence being merged by merge_all()
+    struct MergeCursor
     {
-        ::std::pair<iterator, iterator> cutted;
-        iterator end;
+        Node *prev;
+        Node *current;
+        Node *last;
+        // Index of the list in the merge, orders equal elements
+        size_type order;
+    };
+
+    // Detached sequence built node by node, empty if first == nullptr
+    struct DetachedChain
+    {
+        Node *first;
+        Node *last;
+
 
-        CutResult(iterator first, iterator last, iterator end)
-            : cutted(first, last), end(end)
+        explicit DetachedChain(Node *const first = nullptr, Node *const last = nullptr) noexcept
+            : first(first), last(last)
         {}
+
+        void append(Node *const node) noexcept
+        {
+            node->xorPtr = reinterpret_cast<PtrInteger>(last);
+            if (last == nullptr)
+            {
+                first = node;
+            }
+            else
+            {
+                last->xorPtr = xor_list_detail::xorPointers(last->xorPtr, node);
+            }
+            last = node;
+        }
+
+        void prepend(Node *const node) noexcept
+        {
+            node->xorPtr = reinterpret_cast<PtrInteger>(first);
+            if (first == nullptr)
+            {
+                last = node;
+            }
+            else
+            {
+                first->xorPtr = xor_list_detail::xorPointers(first->xorPtr, node);
+            }
+            first = node;
+        }
+
+        void append(const DetachedChain &chain) noexcept
+        {
+            if (chain.first == nullptr)
+            {
+                return;
+            }
+
+            if (last == nullptr)
+            {
+                first = chain.first;
+            }
+            else
+            {
+                last->xorPtr = xor_list_detail::xorPointers(last->xorPtr, chain.first);
+                chain.first->xorPtr = xor_list_detail::xorPointers(chain.first->xorPtr, last);
+            }
+            last = chain.last;
+        }
+    };
+
+    // Retired node, linked into the cache (or into a chain for deallocate_chain()) through its storage
+    struct CachedNode
+    {
+        void *next;
     };
 
+    static_assert(sizeof(CachedNode) <= sizeof(NodeWithValue), "Cached node must fit into a node");
+
+    // radix_sort() takes a byte of the key per pass
+    static constexpr int radixBits = 8;
+    static constexpr ::std::size_t radixBuckets = ::std::size_t{ 1 } << radixBits;
+
+    // Smaller chunks don't pay for starting a thread
+    static constexpr size_type minParallelSortChunk = 16384;
+
 
     NodeAllocator allocator;
     mutable Node beforeHead;
     mutable Node afterTail;
-    size_type length = 0;
+    CachedNode *cachedNodes = nullptr;
+    size_type cachedCount = 0;
+    size_type cacheCapacity = 0;
+
+
+    NodeWithValue* allocateNode()
+    {
+        if (cachedNodes == nullptr)
+        {
+            return ::std::allocator_traits<NodeAllocator>::allocate(allocator, 1);
+        }
+
+        CachedNode *const result = cachedNodes;
+        cachedNodes = static_cast<CachedNode*>(result->next);
+        --cachedCount;
+
+        return reinterpret_cast<NodeWithValue*>(result);
+    }
+
+    void deallocateNode(NodeWithValue *const node) noexcept
+    {
+        if (cachedCount < cacheCapacity)
+        {
+            cacheNode(node);
+        }
+        else
+        {
+            ::std::allocator_traits<NodeAllocator>::deallocate(allocator, node, 1);
+        }
+    }
+
+    void cacheNode(NodeWithValue *const node) noexcept
+    {
+        cachedNodes = ::new (static_cast<void*>(node)) CachedNode{ cachedNodes };
+        ++cachedCount;
+    }
+
+    void releaseCache() noexcept
+    {
+        if (cachedNodes != nullptr)
+        {
+            deallocateCached(cachedNodes);
+
+            cachedNodes = nullptr;
+            cachedCount = 0;
+        }
+    }
+
+    // Frees the nodes of a chain linked through CachedNode::next
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<xor_list_detail::IsMonotonicAllocator<Alloc>::value>::type
+    deallocateCached(CachedNode*) noexcept
+    {
+    }
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<!xor_list_detail::IsMonotonicAllocator<Alloc>::value
+                              && xor_list_detail::HasDeallocateChain<Alloc>::value>::type
+    deallocateCached(CachedNode *const first) noexcept
+    {
+        CachedNode *last = first;
+        size_type count = 1;
+        for (; last->next != nullptr; ++count)
+        {
+            last = static_cast<CachedNode*>(last->next);
+        }
+
+        allocator.deallocate_chain(reinterpret_cast<NodeWithValue*>(first), reinterpret_cast<NodeWithValue*>(last), count);
+    }
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<!xor_list_detail::IsMonotonicAllocator<Alloc>::value
+                              && !xor_list_detail::HasDeallocateChain<Alloc>::value>::type
+    deallocateCached(CachedNode *first) noexcept
+    {
+        while (first != nullptr)
+        {
+            CachedNode *const node = first;
+            first = static_cast<CachedNode*>(node->next);
+
+            ::std::allocator_traits<NodeAllocator>::deallocate(allocator, reinterpret_cast<NodeWithValue*>(node), 1);
+        }
+    }
+
+    void swapCaches(xor_list &other) noexcept
+    {
+        ::std::swap(cachedNodes, other.cachedNodes);
+        ::std::swap(cachedCount, other.cachedCount);
+        ::std::swap(cacheCapacity, other.cacheCapacity);
+    }
+
+
+    template<typename... Args>
+    NodeWithValue* createNode(Args&&... args)
+    {
+        static_assert(!::std::is_polymorphic<NodeWithValue>::value, "Node must not carry a vtable pointer");
+        static_assert(sizeof(NodeWithValue) == sizeof(NodeLayout), "Node must be exactly a link and a value");
+
+        NodeWithValue *const result = allocateNode();
+
+        try
+        {
+            ::std::allocator_traits<NodeAllocator>::construct(allocator, result, ::std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            deallocateNode(result);
+            throw;
+        }
+
+        return result;
+    }
+
+
+    // Builds a detached sequence (see cutSequence) of count nodes initialized by construct(NodeWithValue*)
+    // Monotonic allocators never free single nodes (deallocate() is a no-op), so all of them are taken from one allocation
+    // strong exception-safe guarantee
+    template<typename Construct>
+    ::std::pair<iterator, iterator> createSequence(size_type count, Construct &construct)
+    {
+        CachedNode *preallocated = nullptr;
+        return createSequence(count, construct, preallocated);
+    }
+
+    // Nodes are taken from the preallocated chain (see allocateChain()) while it lasts
+    template<typename Construct>
+    ::std::pair<iterator, iterator> createSequence(size_type count, Construct &construct, CachedNode *&preallocated)
+    {
+        NodeWithValue *const batch = xor_list_detail::IsMonotonicAllocator<NodeAllocator>::value
+                                     ? ::std::allocator_traits<NodeAllocator>::allocate(allocator, count)
+                                     : nullptr;
+
+        iterator begin;
+        iterator end;
+
+        try
+        {
+            for (size_type i = 0; i < count; ++i)
+            {
+                NodeWithValue *node = batch + i;
+                if (batch == nullptr)
+                {
+                    node = (preallocated != nullptr) ? popChain(preallocated) : allocateNode();
+                }
+
+                try
+                {
+                    construct(node);
+                }
+                catch (...)
+                {
+                    if (batch == nullptr)
+                    {
+                        deallocateNode(node);
+                    }
+                    throw;
+                }
+
+                const auto inserted = Sequences::insertNodeBefore(end, node);
+
+                if (i == 0)
+                {
+                    begin = inserted.first;
+                }
+                end = inserted.second;
+            }
+        }
+        catch (...)
+        {
+            for (; begin != end; )
+            {
+                NodeWithValue *const node = static_cast<NodeWithValue*>((++begin).prev);
+
+                ::std::allocator_traits<NodeAllocator>::destroy(allocator, node);
+                if (batch == nullptr)
+                {
+                    deallocateNode(node);
+                }
+            }
+
+            if (batch != nullptr)
+            {
+                ::std::allocator_traits<NodeAllocator>::deallocate(allocator, batch, count);
+            }
 
+            throw;
+        }
+
+        return { begin, end };
+    }
+
+    // Allocates count nodes bypassing the cache and links them through CachedNode::next in allocation order
+    // Nothing is leaked if an exception is thrown
+    CachedNode* allocateChain(size_type count)
+    {
+        CachedNode *first = nullptr;
+        CachedNode *last = nullptr;
+
+        try
+        {
+            for (; count > 0; --count)
+            {
+                NodeWithValue *const node = ::std::allocator_traits<NodeAllocator>::allocate(allocator, 1);
+                CachedNode *const link = ::new (static_cast<void*>(node)) CachedNode{ nullptr };
+
+                if (last == nullptr)
+                {
+                    first = link;
+                }
+                else
+                {
+                    last->next = link;
+                }
+                last = link;
+            }
+        }
+        catch (...)
+        {
+            if (first != nullptr)
+            {
+                deallocateCached(first);
+            }
+            throw;
+        }
 
-    static PtrInteger xorPointers(Node *const first, Node *const second) noexcept
+        return first;
+    }
+
+    static NodeWithValue* popChain(CachedNode *&chain) noexcept
+    {
+        CachedNode *const result = chain;
+        chain = static_cast<CachedNode*>(result->next);
+
+        return reinterpret_cast<NodeWithValue*>(result);
+    }
+
+    // Links count constructed nodes before position at once
+    // strong exception-safe guarantee
+    template<typename Construct>
+    iterator insertConstructed(const_iterator position, size_type count, Construct construct)
     {
-        return xorPointers(reinterpret_cast<const PtrInteger>(first),
-                           reinterpret_cast<const PtrInteger>(second));
+        if (count == 0)
+        {
+            return static_cast<iterator>(position);
+        }
+
+        const auto sequence = createSequence(count, construct);
+
+        //insertSequenceToThisBefore noexcept!
+        return insertSequenceToThisBefore(position, sequence.first, sequence.second, count).first;
+    }
+
+    template<typename InputIterator>
+    iterator insertRange(const_iterator position, InputIterator first, InputIterator last, ::std::input_iterator_tag)
+    {
+        if (first == last)
+        {
+            return static_cast<iterator>(position);
+        }
+
+        const iterator result = insert(position, *first);
+        position = result;
+        size_type insertedCount = 1;
+
+        for (++position ; ++first != last; ++position, ++insertedCount)
+        {
+            try
+            {
+                position = insert(position, *first);
+            }
+            catch(...)
+            {
+                destroySequence(result, position, insertedCount);
+                throw;
+            }
+        }
+
+        return result;
+    }
+
+    // The size is known in advance, so the nodes are linked into the list at once
+    template<typename ForwardIterator>
+    iterator insertRange(const_iterator position, ForwardIterator first, ForwardIterator last,
+                         ::std::forward_iterator_tag)
+    {
+        return insertCounted(position, first, static_cast<size_type>(::std::distance(first, last)));
+    }
+
+    template<typename InputIterator>
+    iterator insertCounted(const_iterator position, InputIterator first, size_type count)
+    {
+        return insertConstructed(position, count, [this, &first](NodeWithValue *const node)
+        {
+            // Same as insert(position, *first)
+            const_reference value = *first;
+
+            ::std::allocator_traits<NodeAllocator>::construct(allocator, node, value);
+            ++first;
+        });
+    }
+
+
+    // Counts are needed only to keep the size, so they aren't computed with xor_list_untracked_size
+    size_type trackedSize() const noexcept
+    {
+        return this->countedSize();
+    }
+
+    size_type trackedDistance(const_iterator first, const_iterator last) const noexcept
+    {
+        return this->tracksSize ? static_cast<size_type>(::std::distance(first, last)) : 0;
+    }
+
+    bool hasLessThanTwoElements() const noexcept
+    {
+        return (empty() || (::std::next(cbegin()) == cend()));
+    }
+
+    // Walks at most n elements if the size isn't tracked
+    bool hasAtLeast(const size_type n) const noexcept
+    {
+        if (this->tracksSize)
+        {
+            return (trackedSize() >= n);
+        }
+
+        size_type count = 0;
+        for (auto iter = cbegin(); (count < n) && (iter != cend()); ++iter)
+        {
+            ++count;
+        }
+
+        return (count == n);
+    }
+
+    // hasAtLeast(n + 1) without overflowing n + 1
+    bool hasMoreThan(const size_type n) const noexcept
+    {
+        return (n < ::std::numeric_limits<size_type>::max()) && hasAtLeast(n + 1);
+    }
+
+
+    ::std::pair<iterator, iterator>
+    insertNodeToThisBefore(const_iterator position, NodeWithValue *const node) noexcept
+    {
+        this->addToSize(1);
+        return Sequences::insertNodeBefore(position, node);
+    }
+
+    template<typename I>
+    ::std::pair<iterator, iterator>
+    insertSequenceToThisBefore(const_iterator position, const_iterator begin,
+                               const_iterator end, I distance) noexcept
+    {
+        this->addToSize(distance);
+        return Sequences::insertSequenceBefore(position, begin, end);
+    }
+    template<typename I>
+    CutResult
+    cutSequenceFromThis(const_iterator first, const_iterator last, I distance) noexcept
+    {
+        this->subtractFromSize(distance);
+        return Sequences::cutSequence(first, last);
+    }
+
+    template<typename I>
+    void destroySequence(const_iterator begin, const_iterator end, I distance)
+    {
+        if (distance == 0)
+        {
+            return;
+        }
+
+        ::std::tie(begin, end) = cutSequenceFromThis(begin, end, distance).cutted; // noexcept!
+
+        (void)destroyDetached(begin, end, static_cast<size_type>(distance));
+    }
+
+    // Same as above, but the elements are counted while being destroyed
+    // Returns the number of destroyed elements
+    size_type destroySequence(const_iterator begin, const_iterator end)
+    {
+        if (begin == end)
+        {
+            return 0;
+        }
+
+        ::std::tie(begin, end) = Sequences::cutSequence(begin, end).cutted; // noexcept!
+
+        const size_type destroyed = destroyDetached(begin, end, 0);
+        this->subtractFromSize(destroyed);
+
+        return destroyed;
+    }
+
+    // Destroys and frees the detached sequence [begin, end) of count nodes (0 if unknown)
+    // Returns the number of destroyed nodes
+    size_type destroyDetached(const_iterator begin, const_iterator end, size_type count) noexcept
+    {
+        size_type destroyed = 0;
+
+        // Retired nodes go to the cache first (see reserve())
+        for (; (begin != end) && (cachedCount < cacheCapacity); ++destroyed)
+        {
+            NodeWithValue *const node = static_cast<NodeWithValue*>((++begin).prev);
+
+            destroyValue(node);
+            cacheNode(node);
+        }
+
+        if (begin != end)
+        {
+            destroyed += freeSequence(begin, end, (count != 0) ? (count - destroyed) : 0);
+        }
+
+        return destroyed;
+    }
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<!xor_list_detail::IsTriviallyDestroyable<Alloc, NodeWithValue>::value>::type
+    destroyValue(NodeWithValue *const node) noexcept
+    {
+        ::std::allocator_traits<NodeAllocator>::destroy(allocator, node);
+    }
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<xor_list_detail::IsTriviallyDestroyable<Alloc, NodeWithValue>::value>::type
+    destroyValue(NodeWithValue*) noexcept
+    {
+    }
+
+    // Destroys and frees all the nodes of the non-empty detached sequence [begin, end) of count nodes (0 if unknown)
+    // Returns the number of the nodes
+    // deallocate() of monotonic allocators is a no-op, so the sequence isn't even walked
+    //  for trivially destructible T if count is known
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<xor_list_detail::IsMonotonicAllocator<Alloc>::value, size_type>::type
+    freeSequence(const_iterator begin, const_iterator end, size_type count) noexcept
+    {
+        if (xor_list_detail::IsTriviallyDestroyable<Alloc, NodeWithValue>::value && (count != 0))
+        {
+            return count;
+        }
+
+        size_type destroyed = 0;
+        for (; begin != end; ++destroyed)
+        {
+            destroyValue(static_cast<NodeWithValue*>((++begin).prev));
+        }
+
+        return destroyed;
+    }
+
+    // The nodes are relinked into a chain and given to the allocator at once
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<!xor_list_detail::IsMonotonicAllocator<Alloc>::value
+                              && xor_list_detail::HasDeallocateChain<Alloc>::value, size_type>::type
+    freeSequence(const_iterator begin, const_iterator end, size_type) noexcept
+    {
+        NodeWithValue *const first = static_cast<NodeWithValue*>(begin.current);
+        NodeWithValue *last = nullptr;
+        size_type count = 0;
+
+        for (; begin != end; ++count)
+        {
+            NodeWithValue *const node = static_cast<NodeWithValue*>((++begin).prev);
+
+            destroyValue(node);
+
+            // The links of the previous node aren't needed anymore
+            if (last != nullptr)
+            {
+                (void)::new (static_cast<void*>(last)) CachedNode{ node };
+            }
+            last = node;
+        }
+
+        (void)::new (static_cast<void*>(last)) CachedNode{ nullptr };
+
+        allocator.deallocate_chain(first, last, count);
+
+        return count;
+    }
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<!xor_list_detail::IsMonotonicAllocator<Alloc>::value
+                              && !xor_list_detail::HasDeallocateChain<Alloc>::value, size_type>::type
+    freeSequence(const_iterator begin, const_iterator end, size_type) noexcept
+    {
+        size_type destroyed = 0;
+        for (; begin != end; ++destroyed)
+        {
+            NodeWithValue *const node = static_cast<NodeWithValue*>((++begin).prev);
+
+            destroyValue(node);
+            ::std::allocator_traits<NodeAllocator>::deallocate(allocator, node, 1);
+        }
+
+        return destroyed;
+    }
+
+
+    void swapWithoutAllocators(xor_list &other)
+    {
+        const auto thisDistance = trackedSize();
+        const auto otherDistance = other.trackedSize();
+
+        if (!empty())
+        {
+            auto thisCutResult = cutSequenceFromThis(cbegin(), cend(), thisDistance);
+
+            if (!other.empty())
+            {
+                auto otherCutResult = other.cutSequenceFromThis(other.cbegin(), other.cend(), otherDistance);
+                (void)insertSequenceToThisBefore(cbegin(), otherCutResult.cutted.first, otherCutResult.cutted.second,
+                                                 otherDistance);
+            }
+
+            (void)other.insertSequenceToThisBefore(other.cbegin(), thisCutResult.cutted.first,
+                                                   thisCutResult.cutted.second, thisDistance);
+        }
+        else if (!other.empty())
+        {
+            auto otherCutResult = other.cutSequenceFromThis(other.cbegin(), other.cend(), otherDistance);
+            (void)insertSequenceToThisBefore(cbegin(), otherCutResult.cutted.first, otherCutResult.cutted.second,
+                                             otherDistance);
+        }
+    }
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_swap::value>::type
+    swapImpl(xor_list &other)
+    {
+        ::std::swap(allocator, other.allocator);
+        swapCaches(other);
+        swapWithoutAllocators(other);
+    }
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_swap::value>::type
+    swapImpl(xor_list &other)
+    {
+        // Allocators are equal, so the cached nodes may be swapped too
+        swapCaches(other);
+        swapWithoutAllocators(other);
+    }
+
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value>::type
+    copyAssignmentImpl(const xor_list &right)
+    {
+        clear();
+        releaseCache();
+        allocator = right.allocator;
+        assign(right.cbegin(), right.cend());
+    }
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value>::type
+    copyAssignmentImpl(const xor_list &right)
+    {
+        clear();
+        assign(right.cbegin(), right.cend());
+    }
+
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value>::type
+    moveAssignmentImpl(xor_list &&right)
+    {
+        clear();
+        releaseCache();
+        allocator = ::std::move(right.allocator);
+        splice(cbegin(), right);
+
+        cachedNodes = right.cachedNodes;
+        cachedCount = right.cachedCount;
+        right.cachedNodes = nullptr;
+        right.cachedCount = 0;
+    }
+
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value>::type
+    moveAssignmentImpl(xor_list &&right)
+    {
+        clear();
+
+        if (allocator == right.allocator)
+        {
+            splice(cbegin(), right);
+        }
+        else
+        {
+            for (T &moved : right)
+            {
+                emplace_back(::std::move(moved));
+            }
+
+            right.clear();
+        }
+    }
+
+
+    template<typename Alloc = NodeAllocator>
+    using CompactsInPlace = ::std::integral_constant<bool, xor_list_detail::IsPooledAllocator<Alloc>::value
+                                                           && ::std::is_nothrow_move_constructible<T>::value
+                                                           && ::std::is_nothrow_move_assignable<T>::value>;
+
+    // The elements are moved into fresh nodes allocated in list order
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<!CompactsInPlace<Alloc>::value>::type
+    compactImpl()
+    {
+        const auto count = size();
+
+        // All the fresh nodes are allocated before any element is moved
+        CachedNode *fresh = xor_list_detail::IsMonotonicAllocator<Alloc>::value ? nullptr : allocateChain(count);
+
+        auto source = begin();
+        auto moveConstruct = [this, &source](NodeWithValue *const node)
+        {
+            ::std::allocator_traits<NodeAllocator>::construct(allocator, node, ::std::move_if_noexcept(*source));
+            ++source;
+        };
+
+        ::std::pair<iterator, iterator> sequence;
+        try
+        {
+            sequence = createSequence(count, moveConstruct, fresh);
+        }
+        catch (...)
+        {
+            if (fresh != nullptr)
+            {
+                deallocateCached(fresh);
+            }
+            throw;
+        }
+
+        destroySequence(cbegin(), cend(), count);
+        (void)insertSequenceToThisBefore(cend(), sequence.first, sequence.second, count);
+    }
+
+    // The nodes stay in place, the elements are permuted so that the list order follows the node addresses
+    template<typename Alloc = NodeAllocator>
+    typename ::std::enable_if<CompactsInPlace<Alloc>::value>::type
+    compactImpl()
+    {
+        const auto count = size();
+
+        // (node address, index of its element)
+        using Slot = ::std::pair<NodeWithValue*, size_type>;
+        using NodePtrAllocator = typename ::std::allocator_traits<NodeAllocator>::template rebind_alloc<NodeWithValue*>;
+        using SlotAllocator = typename ::std::allocator_traits<NodeAllocator>::template rebind_alloc<Slot>;
+
+        // nodes[i] holds the i-th element, byAddress are the same nodes in the address order
+        // The addresses are sorted together with the indices to keep the sort cache-friendly
+        ::std::vector<NodeWithValue*, NodePtrAllocator> nodes(NodePtrAllocator{ allocator });
+        ::std::vector<Slot, SlotAllocator> byAddress(SlotAllocator{ allocator });
+
+        nodes.reserve(count);
+        byAddress.reserve(count);
+
+        for (auto iter = cbegin(); iter != cend(); ++iter)
+        {
+            byAddress.emplace_back(static_cast<NodeWithValue*>(iter.current), nodes.size());
+            nodes.push_back(static_cast<NodeWithValue*>(iter.current));
+        }
+
+        ::std::sort(byAddress.begin(), byAddress.end(), [](const Slot &left, const Slot &right)
+        {
+            return ::std::less<NodeWithValue*>{}(left.first, right.first);
+        });
+
+        // No exceptions from here on
+        // The i-th element goes to the i-th node by address, i.e. to nodes[byAddress[i].second]
+        for (size_type start = 0; start < count; ++start)
+        {
+            if (byAddress[start].second == start)
+            {
+                continue;
+            }
+
+            T carried(::std::move(nodes[start]->value));
+
+            size_type i = start;
+            do
+            {
+                const size_type next = byAddress[i].second;
+                byAddress[i].second = i;
+
+                ::std::swap(carried, nodes[next]->value);
+                i = next;
+            } while (i != start);
+        }
+
+        Node *prev = ::std::addressof(beforeHead);
+        for (size_type i = 0; i < count; ++i)
+        {
+            Node *const next = (i + 1 < count) ? static_cast<Node*>(byAddress[i + 1].first) : ::std::addressof(afterTail);
+
+            byAddress[i].first->xorPtr = xor_list_detail::xorPointers(prev, next);
+            prev = byAddress[i].first;
+        }
+
+        beforeHead.xorPtr = reinterpret_cast<PtrInteger>(static_cast<Node*>(byAddress.front().first));
+        afterTail.xorPtr = reinterpret_cast<PtrInteger>(static_cast<Node*>(byAddress.back().first));
+    }
+
+
+    // Stable distribution of the detached sequence (see Sequences::cutSequence) by the key byte at shift
+    // The buckets are detached sequences too, sequence becomes all of them one after another
+    // If key throws, sequence becomes the buckets followed by the nodes that aren't distributed yet
+    template<typename KeyFunction>
+    void distributeSequence(::std::pair<iterator, iterator> &sequence, KeyFunction &key, const int shift)
+    {
+        ::std::array<Node*, radixBuckets> heads;
+        ::std::array<Node*, radixBuckets> tails;
+        heads.fill(nullptr);
+
+        Node *prev = nullptr;
+        Node *node = sequence.first.current;
+
+        try
+        {
+            while (node != nullptr)
+            {
+                Node *const next = reinterpret_cast<Node*>(xor_list_detail::xorPointers(prev, node->xorPtr));
+                xor_list_detail::prefetch(next);
+
+                const auto bucket = (key(static_cast<NodeWithValue*>(node)->value) >> shift) & (radixBuckets - 1);
+                if (heads[bucket] == nullptr)
+                {
+                    heads[bucket] = node;
+                    node->xorPtr = 0;
+                }
+                else
+                {
+                    tails[bucket]->xorPtr = xor_list_detail::xorPointers(tails[bucket]->xorPtr, node);
+                    node->xorPtr = reinterpret_cast<PtrInteger>(tails[bucket]);
+                }
+                tails[bucket] = node;
+
+                prev = node;
+                node = next;
+            }
+        }
+        catch (...)
+        {
+            // node and the ones after it are still linked as they were
+            node->xorPtr = xor_list_detail::xorPointers(node->xorPtr, prev);
+            sequence = concatenateBuckets(heads, tails, node, sequence.second.prev);
+            throw;
+        }
+
+        sequence = concatenateBuckets(heads, tails, nullptr, nullptr);
+    }
+
+    // Links the non-empty buckets and then the detached sequence [restFirst, restLast] one after another
+    static ::std::pair<iterator, iterator>
+    concatenateBuckets(const ::std::array<Node*, radixBuckets> &heads, const ::std::array<Node*, radixBuckets> &tails,
+                       Node *const restFirst, Node *const restLast) noexcept
+    {
+        Node *first = nullptr;
+        Node *last = nullptr;
+
+        for (::std::size_t i = 0; i <= radixBuckets; ++i)
+        {
+            Node *const head = (i < radixBuckets) ? heads[i] : restFirst;
+            if (head == nullptr)
+            {
+                continue;
+            }
+
+            if (last == nullptr)
+            {
+                first = head;
+            }
+            else
+            {
+                last->xorPtr = xor_list_detail::xorPointers(last->xorPtr, head);
+                head->xorPtr = xor_list_detail::xorPointers(head->xorPtr, last);
+            }
+            last = (i < radixBuckets) ? tails[i] : restLast;
+        }
+
+        return { { nullptr, first }, { last, nullptr } };
+    }
+
+    // Runs task(0) ... task(count - 1) on the calling thread and count - 1 threads taken into threads
+    // A task whose thread can't be started runs on the calling thread
+    template<typename Task>
+    static void runConcurrently(::std::vector<::std::thread> &threads, const size_type count, const Task &task)
+    {
+        for (size_type i = 1; i < count; ++i)
+        {
+            try
+            {
+                threads.emplace_back(&xor_list::runTask<Task>, ::std::cref(task), i);
+            }
+            catch (...)
+            {
+                runTask(task, i);
+            }
+        }
+
+        runTask(task, 0);
+
+        for (auto &thread : threads)
+        {
+            thread.join();
+        }
+        threads.clear();
     }
 
-    static PtrInteger xorPointers(const PtrInteger first, Node *const second) noexcept
+    template<typename Task>
+    static void runTask(const Task &task, const size_type i) noexcept
     {
-        return xorPointers(second, first);
+        task(i);
     }
 
-    static PtrInteger xorPointers(Node *const first, const PtrInteger second) noexcept
+    // Cuts all the elements of list into a new heap entry
+    template<typename Cursors>
+    static void takeMergeCursor(xor_list &list, Cursors &heap, size_type &moved) noexcept
     {
-        return xorPointers(reinterpret_cast<const PtrInteger>(first), second);
+        if (list.empty())
+        {
+            return;
+        }
+
+        const size_type count = list.trackedSize();
+        const auto range = list.cutSequenceFromThis(list.cbegin(), list.cend(), count).cutted;
+
+        heap.push_back({ nullptr, range.first.current, range.second.prev, heap.size() });
+        moved += count;
     }
 
-    static PtrInteger xorPointers(const PtrInteger first, const PtrInteger second) noexcept
+    // Moves heap[i] down to restore the min-heap order
+    // Entries are swapped, so the heap keeps all of them even if isLess throws
+    template<typename Cursors, typename Compare>
+    static void siftMergeCursor(Cursors &heap, size_type i, Compare &isLess)
     {
-        return first ^ second;
-    }
+        const auto isBefore = [&isLess](const MergeCursor &left, const MergeCursor &right)
+        {
+            const T &leftValue = static_cast<NodeWithValue*>(left.current)->value;
+            const T &rightValue = static_cast<NodeWithValue*>(right.current)->value;
 
+            if (isLess(leftValue, rightValue))
+            {
+                return true;
+            }
+            if (isLess(rightValue, leftValue))
+            {
+                return false;
+            }
 
-    template<typename... Args>
-    NodeWithValue* createNode(Args&&... args)
-    {
-        NodeWithValue *const result = ::std::allocator_traits<NodeAllocator>::allocate(allocator, 1);
+            return (left.order < right.order);
+        };
 
-        try
+        while (true)
         {
-            ::std::allocator_traits<NodeAllocator>::construct(allocator, result, ::std::forward<Args>(args)...);
+            const size_type left = 2 * i + 1;
+            const size_type right = left + 1;
+
+            size_type smallest = i;
+            if ((left < heap.size()) && isBefore(heap[left], heap[smallest]))
+            {
+                smallest = left;
+            }
+            if ((right < heap.size()) && isBefore(heap[right], heap[smallest]))
+            {
+                smallest = right;
+            }
+
+            if (smallest == i)
+            {
+                return;
+            }
+
+            ::std::swap(heap[i], heap[smallest]);
+            i = smallest;
         }
-        catch (...)
+    }
+
+    // Links the merged output, then what's left of the heap entries in their order, to the end of *this
+    template<typename Cursors>
+    void linkMergeRemains(Cursors &heap, Node *const outFirst, Node *const outLast, const size_type moved) noexcept
+    {
+        if (outFirst != nullptr)
         {
-            ::std::allocator_traits<NodeAllocator>::deallocate(allocator, result, 1);
-            throw;
+            (void)Sequences::insertSequenceBefore(cend(), { nullptr, outFirst }, { outLast, nullptr });
         }
 
-        return result;
-    }
+        ::std::sort(heap.begin(), heap.end(), [](const MergeCursor &left, const MergeCursor &right)
+        {
+            return (left.order < right.order);
+        });
 
+        for (auto &cursor : heap)
+        {
+            // The node before current may be linked elsewhere already
+            cursor.current->xorPtr = xor_list_detail::xorPointers(cursor.current->xorPtr, cursor.prev);
+            (void)Sequences::insertSequenceBefore(cend(), { nullptr, cursor.current }, { cursor.last, nullptr });
+        }
 
-    ::std::pair<iterator, iterator>
-    insertNodeToThisBefore(const_iterator position, NodeWithValue *const node) noexcept
-    {
-        ++length;
-        return insertNodeBefore(position, node);
+        this->addToSize(moved);
     }
 
-    // All iterators equal to <position> will become invalid
-    // Returns valid range [inserted, position]
-    static ::std::pair<iterator, iterator>
-    insertNodeBefore(const_iterator position, NodeWithValue *const node) noexcept
+    // Returns false and leaves the list untouched if the buffer can't be allocated
+    //  or the list is nearly sorted in either direction
+    template<typename Compare>
+    bool sortThroughBuffer(Compare &isLess)
     {
-        node->xorPtr = xorPointers(position.prev, position.current);
+        using NodePtrAllocator = typename ::std::allocator_traits<NodeAllocator>::template rebind_alloc<NodeWithValue*>;
 
-        if (position.prev != nullptr)
+        ::std::vector<NodeWithValue*, NodePtrAllocator> nodes(NodePtrAllocator{ allocator });
+
+        try
         {
-            position.prev->xorPtr = xorPointers(xorPointers(position.prev->xorPtr, position.current), node);
+            nodes.reserve(size());
         }
-        if (position.current != nullptr)
+        catch (...)
         {
-            position.current->xorPtr = xorPointers(xorPointers(position.current->xorPtr, position.prev), node);
+            return false;
         }
 
-        return { { position.prev, node }, { node, position.current } };
-    }
-
+        // Neighbours compared in both directions tell how far the list is from being sorted either way
+        size_type ascents = 0;
+        size_type descents = 0;
 
-    template<typename I>
-    ::std::pair<iterator, iterator>
-    insertSequenceToThisBefore(const_iterator position, const_iterator begin,
-                               const_iterator end, I distance) noexcept
-    {
-        length += distance;
-        return insertSequenceBefore(position, begin, end);
-    }
+        for (auto iter = cbegin(); iter != cend(); ++iter)
+        {
+            Sequences::prefetchNext(iter);
 
+            NodeWithValue *const node = static_cast<NodeWithValue*>(iter.current);
+            if (!nodes.empty())
+            {
+                if (isLess(node->value, nodes.back()->value))
+                {
+                    ++descents;
+                }
+                else if (isLess(nodes.back()->value, node->value))
+                {
+                    ++ascents;
+                }
+            }
 
-    // All iterators equal to <position>, <begin> will become invalid
-    // Iterators equal to end still remains valid (--end == result.second)
-    // Returns valid range [begin, position]
-    static ::std::pair<iterator, iterator>
-    insertSequenceBefore(const_iterator position, const_iterator begin,
-                         const_iterator end) noexcept
-    {
-        begin.current->xorPtr = xorPointers(xorPointers(begin.current->xorPtr, begin.prev), position.prev);
-        end.prev->xorPtr = xorPointers(xorPointers(end.prev->xorPtr, end.current), position.current);
+            nodes.push_back(node);
+        }
 
-        if (position.prev != nullptr)
+        // Long natural runs are merged by the node merge sort in about linear time, no need for the array
+        if (::std::min(ascents, descents) < nodes.size() / 32)
         {
-            position.prev->xorPtr = xorPointers(xorPointers(position.prev->xorPtr, position.current), begin.current);
+            return false;
         }
-        if (position.current != nullptr)
+
+        // The links aren't needed until the relinking, so every node keeps its initial index there instead
+        for (size_type i = 0; i < nodes.size(); ++i)
         {
-            position.current->xorPtr = xorPointers(xorPointers(position.current->xorPtr, position.prev), end.prev);
+            nodes[i]->xorPtr = static_cast<PtrInteger>(i);
         }
 
-        return { { position.prev, begin.current }, { end.prev, position.current } };
-    }
+        // Equal elements keep their initial order, so the unstable array sort is stable here
+        try
+        {
+            ::std::sort(nodes.begin(), nodes.end(), [&isLess](const NodeWithValue *left, const NodeWithValue *right)
+            {
+                if (isLess(left->value, right->value))
+                {
+                    return true;
+                }
+                if (isLess(right->value, left->value))
+                {
+                    return false;
+                }
 
+                return (left->xorPtr < right->xorPtr);
+            });
+        }
+        catch (...)
+        {
+            // The array still holds every node once
+            linkInOrder(nodes);
+            throw;
+        }
 
-    template<typename I>
-    CutResult
-    cutSequenceFromThis(const_iterator first, const_iterator last, I distance) noexcept
-    {
-        length -= distance;
-        return cutSequence(first, last);
+        linkInOrder(nodes);
+
+        return true;
     }
 
-    // Returns iterators to the first cutted and following the last cutted elements
-    // Decrement result.first or increment result.second is UB
-    // Dereference result.second is UB
-    // Increment and dereference result.first are still valid
-    // Decrement result.second returns is an iterator to the last cutted element
-    // Iterators equal to begin, end will become invalid
-    static CutResult
-    cutSequence(const_iterator begin, const_iterator end) noexcept
+    // Moves the k smallest elements to the front in sorted order (0 < k < size())
+    // Returns the iterator to the k-th element
+    template<typename Compare>
+    iterator selectSmallest(const size_type k, Compare &isLess)
     {
-        if (begin.prev != nullptr)
+        struct Entry
         {
-            begin.prev->xorPtr = xorPointers(xorPointers(begin.prev->xorPtr, begin.current), end.current);
-        }
-        if (end.current != nullptr)
+            NodeWithValue *node;
+            Node *prev;
+            // The position in the list orders equal elements
+            size_type index;
+            // The position in the sorted part
+            size_type rank;
+        };
+
+        using EntryAllocator = typename ::std::allocator_traits<NodeAllocator>::template rebind_alloc<Entry>;
+
+        const auto isBefore = [&isLess](const Entry &left, const Entry &right)
+        {
+            if (isLess(left.node->value, right.node->value))
+            {
+                return true;
+            }
+            if (isLess(right.node->value, left.node->value))
+            {
+                return false;
+            }
+
+            return (left.index < right.index);
+        };
+
+        ::std::vector<Entry, EntryAllocator> heap(EntryAllocator{ allocator });
+        heap.reserve(k);
+
+        // Max-heap: the top is the greatest of the chosen nodes, the first to be replaced
+        size_type index = 0;
+        for (auto iter = cbegin(); iter != cend(); ++iter, ++index)
         {
-            end.current->xorPtr = xorPointers(xorPointers(end.current->xorPtr, end.prev), begin.prev);
+            Sequences::prefetchNext(iter);
+
+            NodeWithValue *const node = static_cast<NodeWithValue*>(iter.current);
+            if (heap.size() < k)
+            {
+                heap.push_back({ node, iter.prev, index, 0 });
+                if (heap.size() == k)
+                {
+                    ::std::make_heap(heap.begin(), heap.end(), isBefore);
+                }
+            }
+            // A later element goes after the equal ones, so it replaces only a greater one
+            else if (isLess(node->value, heap.front().node->value))
+            {
+                ::std::pop_heap(heap.begin(), heap.end(), isBefore);
+                heap.back() = { node, iter.prev, index, 0 };
+                ::std::push_heap(heap.begin(), heap.end(), isBefore);
+            }
         }
 
-        begin.current->xorPtr = xorPointers(xorPointers(begin.current->xorPtr, begin.prev), nullptr);
-        end.prev->xorPtr = xorPointers(xorPointers(end.prev->xorPtr, end.current), nullptr);
+        ::std::sort_heap(heap.begin(), heap.end(), isBefore);
 
-        return { { nullptr, begin.current }, { end.prev, nullptr }, { begin.prev, end.current } };
-    }
+        // Nothing compares the elements below, so the list is relinked only if no comparison has thrown
+        for (size_type i = 0; i < k; ++i)
+        {
+            heap[i].rank = i;
+        }
 
+        // Cutting a node changes only the links of its neighbours, so the iterators taken in the pass
+        //  stay valid while the nodes are cut from the last one, and the list isn't walked again
+        ::std::sort(heap.begin(), heap.end(), [](const Entry &left, const Entry &right)
+        {
+            return (left.index > right.index);
+        });
 
-    template<typename I>
-    void destroySequence(const_iterator begin, const_iterator end, I distance)
-    {
-        if (distance == 0)
+        for (const Entry &entry : heap)
         {
-            return;
+            const const_iterator iter{ entry.prev, entry.node };
+            (void)cutSequenceFromThis(iter, ::std::next(iter), 1);
         }
 
-        ::std::tie(begin, end) = cutSequenceFromThis(begin, end, distance).cutted; // noexcept!
+        ::std::sort(heap.begin(), heap.end(), [](const Entry &left, const Entry &right)
+        {
+            return (left.rank < right.rank);
+        });
 
-        for (; begin != end; )
+        const_iterator position = cbegin();
+        iterator last;
+        for (const Entry &entry : heap)
         {
-            /*try
-            {*/
-                ::std::allocator_traits<NodeAllocator>::destroy(allocator, static_cast<NodeWithValue*>((++begin).prev));
-            /*}
-            catch (...)
-            {}*/
+            const auto inserted = insertNodeToThisBefore(position, entry.node);
 
-            ::std::allocator_traits<NodeAllocator>::deallocate(allocator, static_cast<NodeWithValue*>(begin.prev), 1);
+            last = inserted.first;
+            position = inserted.second;
         }
-    }
 
+        return last;
+    }
 
-    void swapWithoutAllocators(xor_list &other)
+    // Erases the elements of *this which have (keepMatched == false) or don't have (keepMatched == true)
+    //  an equal element in other, see intersect() and subtract()
+    // Returns the number of the erased elements
+    template<typename Compare>
+    size_type eraseByMatches(const xor_list &other, Compare &isLess, const bool keepMatched)
     {
-        const auto thisDistance = size();
-        const auto otherDistance = other.size();
+        DetachedChain dropped;
+        size_type droppedCount = 0;
 
-        if (!empty())
+        // The elements to erase are cut by runs
+        const_iterator runBegin;
+        size_type runCount = 0;
+
+        const auto cutRun = [this, &dropped, &droppedCount, &runBegin, &runCount](const const_iterator runEnd)
         {
-            auto thisCutResult = cutSequenceFromThis(cbegin(), cend(), thisDistance);
+            const auto cutResult = cutSequenceFromThis(runBegin, runEnd, runCount);
 
-            if (!other.empty())
+            dropped.append(DetachedChain(cutResult.cutted.first.current, cutResult.cutted.second.prev));
+            droppedCount += runCount;
+            runCount = 0;
+
+            return cutResult.end;
+        };
+
+        try
+        {
+            auto match = other.cbegin();
+            for (auto iter = cbegin(); iter != cend(); )
             {
-                auto otherCutResult = other.cutSequenceFromThis(other.cbegin(), other.cend(), otherDistance);
-                (void)insertSequenceToThisBefore(cbegin(), otherCutResult.cutted.first, otherCutResult.cutted.second,
-                                                 otherDistance);
+                Sequences::prefetchNext(iter);
+
+                while ((match != other.cend()) && isLess(*match, *iter))
+                {
+                    ++match;
+                }
+
+                const bool matched = (match != other.cend()) && !isLess(*iter, *match);
+                if (matched)
+                {
+                    ++match;
+                }
+
+                if (matched != keepMatched)
+                {
+                    if (runCount == 0)
+                    {
+                        runBegin = iter;
+                    }
+                    ++runCount;
+                    ++iter;
+                    continue;
+                }
+
+                if (runCount != 0)
+                {
+                    iter = cutRun(iter);
+                }
+                ++iter;
+
+                // Nothing can match the rest, so subtract() keeps it
+                if (!keepMatched && (match == other.cend()))
+                {
+                    break;
+                }
             }
 
-            (void)other.insertSequenceToThisBefore(other.cbegin(), thisCutResult.cutted.first,
-                                                   thisCutResult.cutted.second, thisDistance);
+            if (runCount != 0)
+            {
+                (void)cutRun(cend());
+            }
         }
-        else if (!other.empty())
+        catch (...)
         {
-            auto otherCutResult = other.cutSequenceFromThis(other.cbegin(), other.cend(), otherDistance);
-            (void)insertSequenceToThisBefore(cbegin(), otherCutResult.cutted.first, otherCutResult.cutted.second,
-                                             otherDistance);
+            freeDropped(dropped, droppedCount);
+            throw;
         }
-    }
 
-    template<typename Alloc = NodeAllocator>
-    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_swap::value>::type
-    swapImpl(xor_list &other)
-    {
-        ::std::swap(allocator, other.allocator);
-        swapWithoutAllocators(other);
+        freeDropped(dropped, droppedCount);
+
+        return droppedCount;
     }
 
-    template<typename Alloc = NodeAllocator>
-    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_swap::value>::type
-    swapImpl(xor_list &other)
+    // Destroys the nodes of the detached chain of count nodes
+    void freeDropped(const DetachedChain &dropped, const size_type count) noexcept
     {
-        swapWithoutAllocators(other);
+        if (dropped.first != nullptr)
+        {
+            (void)destroyDetached({ nullptr, dropped.first }, { dropped.last, nullptr }, count);
+        }
     }
 
-
-    template<typename Alloc = NodeAllocator>
-    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value>::type
-    copyAssignmentImpl(const xor_list &right)
+    // Links the nodes between the sentinels in the order of the array
+    template<typename Vector>
+    void linkInOrder(const Vector &nodes) noexcept
     {
-        clear();
-        allocator = right.allocator;
-        assign(right.cbegin(), right.cend());
+        linkInOrder(nodes, [](NodeWithValue *const node)
+        {
+            return node;
+        });
     }
 
-    template<typename Alloc = NodeAllocator>
-    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value>::type
-    copyAssignmentImpl(const xor_list &right)
+    // Same as above, for an array of entries that nodeOf maps to the nodes
+    template<typename Vector, typename NodeOf>
+    void linkInOrder(const Vector &entries, NodeOf nodeOf) noexcept
     {
-        clear();
-        assign(right.cbegin(), right.cend());
+        Node *prev = ::std::addressof(beforeHead);
+        for (size_type i = 0; i < entries.size(); ++i)
+        {
+            Node *const node = nodeOf(entries[i]);
+            Node *const next = (i + 1 < entries.size()) ? static_cast<Node*>(nodeOf(entries[i + 1]))
+                                                        : ::std::addressof(afterTail);
+
+            node->xorPtr = xor_list_detail::xorPointers(prev, next);
+            prev = node;
+        }
+
+        beforeHead.xorPtr = reinterpret_cast<PtrInteger>(static_cast<Node*>(nodeOf(entries.front())));
+        afterTail.xorPtr = reinterpret_cast<PtrInteger>(static_cast<Node*>(nodeOf(entries.back())));
     }
 
 
     template<typename Alloc = NodeAllocator>
-    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value>::type
-    moveAssignmentImpl(xor_list &&right)
+    typename ::std::enable_if<!xor_list_detail::IsMonotonicAllocator<Alloc>::value>::type
+    clearImpl()
     {
-        clear();
-        allocator = ::std::move(right.allocator);
-        splice(cbegin(), right);
+        (void)destroySequence(cbegin(), cend());
     }
 
     template<typename Alloc = NodeAllocator>
-    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value>::type
-    moveAssignmentImpl(xor_list &&right)
+    typename ::std::enable_if<xor_list_detail::IsMonotonicAllocator<Alloc>::value>::type
+    clearImpl()
     {
-        clear();
-
-        if (allocator == right.allocator)
-        {
-            splice(cbegin(), right);
-        }
-        else
+        if (!xor_list_detail::IsTriviallyDestroyable<Alloc, NodeWithValue>::value)
         {
-            for (T &moved : right)
+            for (auto iter = cbegin(); iter != cend(); )
             {
-                emplace_back(::std::move(moved));
+                destroyValue(static_cast<NodeWithValue*>((iter++).current));
             }
+        }
 
-            right.clear();
+        beforeHead.xorPtr = reinterpret_cast<PtrInteger>(::std::addressof(afterTail));
+        afterTail.xorPtr = reinterpret_cast<PtrInteger>(::std::addressof(beforeHead));
+        this->resetSize();
+
+        if (allocator.reset())
+        {
+            // The cached nodes were released with the arena
+            cachedNodes = nullptr;
+            cachedCount = 0;
         }
     }
 
@@ -1045,14 +2967,18 @@ private:
             return;
         }
 
-        while (size() > count)
+        auto thisSize = size();
+        for (; thisSize > count; --thisSize)
         {
             pop_back();
         }
 
-        while (size() < count)
+        if (thisSize < count)
         {
-            emplace_back(::std::forward<Args>(args)...);
+            (void)insertConstructed(cend(), count - thisSize, [this, &args...](NodeWithValue *const node)
+            {
+                ::std::allocator_traits<NodeAllocator>::construct(allocator, node, args...);
+            });
         }
     }
 
@@ -1063,97 +2989,91 @@ private:
                          const_iterator beginFrom, const_iterator endFrom,
                          LessCompare &&isLess, I distance) noexcept
     {
-        length += distance;
-        return mergeSequences(beginTo, endTo, beginFrom, endFrom, ::std::forward<LessCompare>(isLess));
+        this->addToSize(distance);
+        return Sequences::mergeSequences(beginTo, endTo, beginFrom, endFrom, ::std::forward<LessCompare>(isLess));
     }
 
-    // All iterators will become invalid
-    // Return new range [first, second)
-    template<typename LessCompare>
-    static ::std::pair<iterator, iterator>
-    mergeSequences(const_iterator beginTo, const_iterator endTo,
-                   const_iterator beginFrom, const_iterator endFrom,
-                   LessCompare &&isLess) noexcept
-    {
-        const_iterator resultBegin = beginTo;
+};
 
-        while (beginFrom != endFrom)
-        {
-            if (beginTo == endTo)
-            {
-                if (resultBegin == beginTo)
-                {
-                    ::std::tie(resultBegin, endTo) = insertSequenceBefore(beginTo, beginFrom, endFrom);
-                }
-                else
-                {
-                    endTo = insertSequenceBefore(beginTo, beginFrom, endFrom).second;
-                }
 
-                break;
-            }
-            else if (::std::forward<LessCompare>(isLess)(*beginFrom, *beginTo))
-            {
-                auto cutResult = cutSequence(beginFrom, ::std::next(beginFrom));
+// Comparison operators
 
-                if (resultBegin == beginTo)
-                {
-                    ::std::tie(resultBegin, beginTo) = insertNodeBefore(beginTo,
-                                                                        static_cast<NodeWithValue *>(cutResult.cutted.first.current));
-                }
-                else
-                {
-                    beginTo = insertNodeBefore(beginTo,
-                                               static_cast<NodeWithValue *>(cutResult.cutted.first.current)).second;
-                }
+// Same as ::std::equal and ::std::lexicographical_compare, but both lists prefetch their next nodes
 
-                beginFrom = cutResult.end;
-            }
-            else
-            {
-                ++beginTo;
-            }
-        }
+template<typename T, class TAllocator, class SizePolicy>
+bool operator==(const xor_list<T, TAllocator, SizePolicy> &lhs, const xor_list<T, TAllocator, SizePolicy> &rhs)
+{
+    using List = xor_list<T, TAllocator, SizePolicy>;
+    using Sequences = typename List::Sequences;
 
-        return { static_cast<iterator>(resultBegin), static_cast<iterator>(endTo) };
+    if (List::tracksSize && (lhs.size() != rhs.size()))
+    {
+        return false;
     }
-};
 
+    auto left = lhs.cbegin();
+    auto right = rhs.cbegin();
 
-// Comparison operators
+    for (; (left != lhs.cend()) && (right != rhs.cend()); ++left, ++right)
+    {
+        Sequences::prefetchNext(left);
+        Sequences::prefetchNext(right);
 
-template<typename T, class TAllocator>
-bool operator==(const xor_list<T, TAllocator> &lhs, const xor_list<T, TAllocator> &rhs)
-{
-    return ((lhs.size() == rhs.size()) && (::std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin())));
+        if (!(*left == *right))
+        {
+            return false;
+        }
+    }
+
+    return ((left == lhs.cend()) && (right == rhs.cend()));
 }
 
-template<typename T, class TAllocator>
-bool operator!=(const xor_list<T, TAllocator> &lhs, const xor_list<T, TAllocator> &rhs)
+template<typename T, class TAllocator, class SizePolicy>
+bool operator!=(const xor_list<T, TAllocator, SizePolicy> &lhs, const xor_list<T, TAllocator, SizePolicy> &rhs)
 {
     return (!(lhs == rhs));
 }
 
-template<typename T, class TAllocator>
-bool operator<(const xor_list<T, TAllocator> &lhs, const xor_list<T, TAllocator> &rhs)
+template<typename T, class TAllocator, class SizePolicy>
+bool operator<(const xor_list<T, TAllocator, SizePolicy> &lhs, const xor_list<T, TAllocator, SizePolicy> &rhs)
 {
-    return ::std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+    using Sequences = typename xor_list<T, TAllocator, SizePolicy>::Sequences;
+
+    auto left = lhs.cbegin();
+    auto right = rhs.cbegin();
+
+    for (; (left != lhs.cend()) && (right != rhs.cend()); ++left, ++right)
+    {
+        Sequences::prefetchNext(left);
+        Sequences::prefetchNext(right);
+
+        if (*left < *right)
+        {
+            return true;
+        }
+        if (*right < *left)
+        {
+            return false;
+        }
+    }
+
+    return ((left == lhs.cend()) && (right != rhs.cend()));
 }
 
-template<typename T, class TAllocator>
-bool operator>(const xor_list<T, TAllocator> &lhs, const xor_list<T, TAllocator> &rhs)
+template<typename T, class TAllocator, class SizePolicy>
+bool operator>(const xor_list<T, TAllocator, SizePolicy> &lhs, const xor_list<T, TAllocator, SizePolicy> &rhs)
 {
     return (rhs < lhs);
 }
 
-template<typename T, class TAllocator>
-bool operator<=(const xor_list<T, TAllocator> &lhs, const xor_list<T, TAllocator> &rhs)
+template<typename T, class TAllocator, class SizePolicy>
+bool operator<=(const xor_list<T, TAllocator, SizePolicy> &lhs, const xor_list<T, TAllocator, SizePolicy> &rhs)
 {
     return (!(rhs < lhs));
 }
 
-template<typename T, class TAllocator>
-bool operator>=(const xor_list<T, TAllocator> &lhs, const xor_list<T, TAllocator> &rhs)
+template<typename T, class TAllocator, class SizePolicy>
+bool operator>=(const xor_list<T, TAllocator, SizePolicy> &lhs, const xor_list<T, TAllocator, SizePolicy> &rhs)
 {
     return (!(lhs < rhs));
 }
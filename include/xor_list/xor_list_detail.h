@@ -0,0 +1,646 @@
+#ifndef XORLIST_XOR_LIST_DETAIL_H
+#define XORLIST_XOR_LIST_DETAIL_H
+
+#include <utility>          // ::std::forward, ::std::pair
+#include <iterator>         // ::std::next
+#include <type_traits>      // ::std::conditional
+#include <cstdint>          // ::std::uint*_t
+#include <cstddef>          // ::std::size_t
+#include <tuple>            // ::std::tie
+#include <array>            // ::std::array
+
+#if !defined(XOR_LIST_NO_PREFETCH) && defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <xmmintrin.h>      // _mm_prefetch
+#endif
+
+
+// Link machinery shared by the xor lists
+namespace xor_list_detail
+{
+    template<bool c, typename TrueType, typename FalseType>
+    using Cond = typename ::std::conditional<c, TrueType, FalseType>::type;
+
+    static_assert((sizeof(void*) == 1) || (sizeof(void*) == 2)
+                  || (sizeof(void*) == 4) || (sizeof(void*) == 8), "Invalid sizeof pointer");
+
+    using PtrInteger = Cond<sizeof(void*) == 1,
+                            ::std::uint8_t,
+                            Cond<sizeof(void*) == 2,
+                                 ::std::uint16_t,
+                                 Cond<sizeof(void*) == 4,
+                                      ::std::uint32_t,
+                                      ::std::uint64_t> > >;
+
+
+    struct Node
+    {
+        PtrInteger xorPtr;
+
+
+        explicit Node(Node *xorPtr = nullptr)
+            : xorPtr(reinterpret_cast<PtrInteger>(xorPtr))
+        {}
+
+        Node(const Node&) noexcept = default;
+        Node(Node &&) noexcept = default;
+
+        // Non-virtual: nodes are always destroyed through their most derived type,
+        //  so a vptr would only cost an extra pointer per element
+        ~Node() = default;
+
+        Node& operator=(const Node&) noexcept = default;
+        Node& operator=(Node &&) noexcept = default;
+    };
+
+
+    inline PtrInteger xorPointers(const PtrInteger first, const PtrInteger second) noexcept
+    {
+        return first ^ second;
+    }
+
+    inline PtrInteger xorPointers(Node *const first, Node *const second) noexcept
+    {
+        return xorPointers(reinterpret_cast<PtrInteger>(first),
+                           reinterpret_cast<PtrInteger>(second));
+    }
+
+    inline PtrInteger xorPointers(const PtrInteger first, Node *const second) noexcept
+    {
+        return xorPointers(first, reinterpret_cast<PtrInteger>(second));
+    }
+
+    inline PtrInteger xorPointers(Node *const first, const PtrInteger second) noexcept
+    {
+        return xorPointers(reinterpret_cast<PtrInteger>(first), second);
+    }
+
+
+    // Asks the CPU to start loading the cache line at address, never faults
+    // Define XOR_LIST_NO_PREFETCH to turn it off
+    inline void prefetch(const void *const address) noexcept
+    {
+    #if defined(XOR_LIST_NO_PREFETCH)
+        (void)address;
+    #elif defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+    #elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+    #else
+        (void)address;
+    #endif
+    }
+
+
+    // Links of the nodes addressed by pointers: xor_list and xor_intrusive_list
+    // Sequences reach the links only through such a policy, so containers addressing their nodes
+    //  by an index (xor_slab_list) share the relinking algorithms
+    struct NodeLinks final
+    {
+        using Index = Node*;
+        using Link = PtrInteger;
+
+
+        static Index null() noexcept
+        {
+            return nullptr;
+        }
+
+        // context is any iterator of the container owning node
+        template<typename Context>
+        static Link& link(const Context&, Node *const node) noexcept
+        {
+            return node->xorPtr;
+        }
+
+        static Link value(Node *const node) noexcept
+        {
+            return reinterpret_cast<PtrInteger>(node);
+        }
+
+        static Index index(const Link link) noexcept
+        {
+            return reinterpret_cast<Node*>(link);
+        }
+
+        template<typename Context>
+        static const void* address(const Context&, Node *const node) noexcept
+        {
+            return node;
+        }
+    };
+
+
+    // Relinking primitives over the (prev, current) iterators of a container
+    // Iterator and ConstIterator must befriend this class
+    // ConstIterator must be explicitly convertible to Iterator
+    template<typename Iterator, typename ConstIterator, typename Links = NodeLinks>
+    struct Sequences final
+    {
+        using Index = typename Links::Index;
+        using Link = typename Links::Link;
+
+        struct CutResult final
+        {
+            ::std::pair<Iterator, Iterator> cutted;
+            Iterator end;
+
+            CutResult(Iterator first, Iterator last, Iterator end)
+                : cutted(first, last), end(end)
+            {}
+        };
+
+
+        // The address of the next node is known only once the current one is loaded,
+        //  so loops prefetch it before working on *position to overlap the load with the work
+        // position must be dereferenceable
+        static void prefetchNext(ConstIterator position) noexcept
+        {
+            const Link next = Links::value(position.prev) ^ linkOf(position, position.current);
+            prefetch(Links::address(position, Links::index(next)));
+        }
+
+        // All iterators equal to <position> will become invalid
+        // Returns valid range [inserted, position]
+        static ::std::pair<Iterator, Iterator>
+        insertNodeBefore(ConstIterator position, const Index node) noexcept
+        {
+            linkOf(position, node) = static_cast<Link>(Links::value(position.prev) ^ Links::value(position.current));
+
+            if (position.prev != Links::null())
+            {
+                relink(position, position.prev, position.current, node);
+            }
+            if (position.current != Links::null())
+            {
+                relink(position, position.current, position.prev, node);
+            }
+
+            return { at<Iterator>(position, position.prev, node), at<Iterator>(position, node, position.current) };
+        }
+
+        // All iterators equal to <position>, <begin> will become invalid
+        // Iterators equal to end still remains valid (--end == result.second)
+        // Returns valid range [begin, position]
+        static ::std::pair<Iterator, Iterator>
+        insertSequenceBefore(ConstIterator position, ConstIterator begin,
+                             ConstIterator end) noexcept
+        {
+            relink(position, begin.current, begin.prev, position.prev);
+            relink(position, end.prev, end.current, position.current);
+
+            if (position.prev != Links::null())
+            {
+                relink(position, position.prev, position.current, begin.current);
+            }
+            if (position.current != Links::null())
+            {
+                relink(position, position.current, position.prev, end.prev);
+            }
+
+            return { at<Iterator>(position, position.prev, begin.current),
+                     at<Iterator>(position, end.prev, position.current) };
+        }
+
+        // Returns iterators to the first cutted and following the last cutted elements
+        // Decrement result.first or increment result.second is UB
+        // Dereference result.second is UB
+        // Increment and dereference result.first are still valid
+        // Decrement result.second returns is an iterator to the last cutted element
+        // Iterators equal to begin, end will become invalid
+        static CutResult
+        cutSequence(ConstIterator begin, ConstIterator end) noexcept
+        {
+            if (begin.prev != Links::null())
+            {
+                relink(begin, begin.prev, begin.current, end.current);
+            }
+            if (end.current != Links::null())
+            {
+                relink(begin, end.current, end.prev, begin.prev);
+            }
+
+            relink(begin, begin.current, begin.prev, Links::null());
+            relink(begin, end.prev, end.current, Links::null());
+
+            return { at<Iterator>(begin, Links::null(), begin.current), at<Iterator>(begin, end.prev, Links::null()),
+                     at<Iterator>(begin, begin.prev, end.current) };
+        }
+
+        // Reverses [first, last) relinking only its ends and their outer neighbours: O(1)
+        // Iterators to the elements of [first, last] will become invalid
+        // Returns the reversed range
+        static ::std::pair<Iterator, Iterator>
+        reverseSequence(ConstIterator first, ConstIterator last) noexcept
+        {
+            if ((first == last) || (::std::next(first) == last))
+            {
+                return { static_cast<Iterator>(first), static_cast<Iterator>(last) };
+            }
+
+            const Index before = first.prev;
+            const Index front = first.current;
+            const Index back = last.prev;
+            const Index after = last.current;
+
+            if (before != Links::null())
+            {
+                relink(first, before, front, back);
+            }
+            if (after != Links::null())
+            {
+                relink(first, after, back, front);
+            }
+
+            relink(first, front, before, after);
+            relink(first, back, after, before);
+
+            return { at<Iterator>(first, before, back), at<Iterator>(first, front, after) };
+        }
+
+        // All iterators will become invalid
+        // Return new range [first, second)
+        // After minGallop wins in a row one side gallops: the end of its winning run is found
+        //  with O(log k) comparisons (see gallop()), then a From run is relinked at once
+        template<typename LessCompare>
+        static ::std::pair<Iterator, Iterator>
+        mergeSequences(ConstIterator beginTo, ConstIterator endTo,
+                       ConstIterator beginFrom, ConstIterator endFrom,
+                       LessCompare &&isLess) noexcept
+        {
+            ConstIterator resultBegin = beginTo;
+            mergeSteps(resultBegin, endTo, beginFrom, endFrom, isLess);
+
+            return { static_cast<Iterator>(resultBegin), static_cast<Iterator>(endTo) };
+        }
+
+        using Range = ::std::pair<ConstIterator, ConstIterator>;
+
+        // Stable natural merge sort of the detached sequence (see cutSequence)
+        // Non-descending runs are taken as they are, strictly descending runs are reversed in O(1),
+        //  then the runs are merged keeping the TimSort invariants on their lengths,
+        //  so sorted, reverse sorted and nearly sorted sequences take O(n)
+        // sequence is replaced by the sorted sequence in the same form
+        // If isLess throws, sequence still holds all the elements, in unspecified order
+        template<typename LessCompare>
+        static void sortSequence(Range &sequence, LessCompare &&isLess)
+        {
+            // The invariants make run lengths grow at least as fast as Fibonacci numbers
+            ::std::array<Run, 96> runs;
+            ::std::size_t runCount = 0;
+
+            ConstIterator begin = sequence.first;
+            Run run{ sequence, 0 };
+
+            try
+            {
+                while (begin != sequence.second)
+                {
+                    cutRun(run, begin, sequence.second, isLess);
+                    runs[runCount++] = run;
+                    run.length = 0;
+
+                    collapseRuns(runs, runCount, isLess);
+                }
+
+                while (runCount > 1)
+                {
+                    mergeRuns(runs, runCount, runCount - 2, isLess);
+                }
+            }
+            catch (...)
+            {
+                if (run.length > 0)
+                {
+                    runs[runCount++] = run;
+                }
+
+                sequence = concatenateRuns(runs, runCount, { begin, sequence.second });
+                throw;
+            }
+
+            sequence = runs[0].range;
+        }
+
+    private:
+
+        static Link& linkOf(const ConstIterator &context, const Index node) noexcept
+        {
+            return Links::link(context, node);
+        }
+
+        // Replaces the neighbour <from> of node by <to>
+        static void relink(const ConstIterator &context, const Index node, const Index from, const Index to) noexcept
+        {
+            Link &link = linkOf(context, node);
+            link = static_cast<Link>(link ^ Links::value(from) ^ Links::value(to));
+        }
+
+        // An iterator to (prev, current) of the container of context
+        template<typename It>
+        static It at(const ConstIterator &context, const Index prev, const Index current) noexcept
+        {
+            It result = static_cast<It>(context);
+            result.prev = prev;
+            result.current = current;
+            return result;
+        }
+
+        // Wins in a row after which mergeSequences() starts galloping, as in TimSort
+        static constexpr ::std::size_t minGallop = 7;
+        static constexpr ::std::size_t maxGallopStep = 64;
+
+        struct Run
+        {
+            Range range;
+            ::std::size_t length;
+        };
+
+        static constexpr ::std::size_t minRunLength = 16;
+
+
+        // Returns the end of the prefix of [begin, end) whose elements satisfy isInPrefix
+        // isInPrefix must hold for begin
+        // Probes 1, 2, 4... up to maxGallopStep elements ahead, then binary searches the last step:
+        //  O(log k + k / maxGallopStep) calls of isInPrefix for a prefix of k elements
+        // Unlike an array, a list is walked node by node anyway, so the step is capped:
+        //  the binary search walks the last step again and it should still be in the cache
+        template<typename Predicate>
+        static ConstIterator gallop(ConstIterator begin, const ConstIterator end, Predicate isInPrefix)
+        {
+            ::std::size_t step = 1;
+            ::std::size_t walked = 0;
+            ConstIterator probe = begin;
+
+            while (true)
+            {
+                probe = begin;
+                for (walked = 0; (walked < step) && (probe != end); ++walked)
+                {
+                    ++probe;
+                }
+
+                if ((probe == end) || !isInPrefix(probe))
+                {
+                    break;
+                }
+
+                begin = probe;
+                if (step < maxGallopStep)
+                {
+                    step *= 2;
+                }
+            }
+
+            // The answer is in (begin, probe]: walked - 1 elements between them are unknown
+            ConstIterator first = ::std::next(begin);
+            ::std::size_t unknown = walked - 1;
+
+            while (unknown > 0)
+            {
+                const ::std::size_t half = unknown / 2;
+                const ConstIterator middle = ::std::next(first, half);
+
+                if (isInPrefix(middle))
+                {
+                    first = ::std::next(middle);
+                    unknown -= half + 1;
+                }
+                else
+                {
+                    unknown = half;
+                }
+            }
+
+            return first;
+        }
+
+        // The loop of mergeSequences(), the ranges are updated in place after every relinking:
+        //  if isLess throws, [resultBegin, endTo) is the To sequence with the From elements merged so far
+        //  and [beginFrom, endFrom) holds the rest of From
+        template<typename LessCompare>
+        static void mergeSteps(ConstIterator &resultBegin, ConstIterator &endTo,
+                               ConstIterator &beginFrom, const ConstIterator endFrom, LessCompare &isLess)
+        {
+            ConstIterator beginTo = resultBegin;
+            ::std::size_t toWins = 0;
+            ::std::size_t fromWins = 0;
+
+            while (beginFrom != endFrom)
+            {
+                if (beginTo == endTo)
+                {
+                    if (resultBegin == beginTo)
+                    {
+                        ::std::tie(resultBegin, endTo) = insertSequenceBefore(beginTo, beginFrom, endFrom);
+                    }
+                    else
+                    {
+                        endTo = insertSequenceBefore(beginTo, beginFrom, endFrom).second;
+                    }
+
+                    beginFrom = endFrom;
+                    break;
+                }
+
+                prefetchNext(beginTo);
+                prefetchNext(beginFrom);
+
+                if (isLess(*beginFrom, *beginTo))
+                {
+                    toWins = 0;
+
+                    ::std::pair<Iterator, Iterator> inserted;
+                    if (++fromWins < minGallop)
+                    {
+                        auto cutResult = cutSequence(beginFrom, ::std::next(beginFrom));
+                        inserted = insertNodeBefore(beginTo, cutResult.cutted.first.current);
+                        beginFrom = cutResult.end;
+                    }
+                    else
+                    {
+                        const ConstIterator to = beginTo;
+                        const ConstIterator runEnd = gallop(beginFrom, endFrom, [&isLess, to](ConstIterator from)
+                        {
+                            return isLess(*from, *to);
+                        });
+
+                        auto cutResult = cutSequence(beginFrom, runEnd);
+                        inserted = insertSequenceBefore(beginTo, cutResult.cutted.first, cutResult.cutted.second);
+                        beginFrom = cutResult.end;
+                    }
+
+                    if (resultBegin == beginTo)
+                    {
+                        resultBegin = inserted.first;
+                    }
+                    beginTo = inserted.second;
+                }
+                else
+                {
+                    fromWins = 0;
+
+                    if (++toWins < minGallop)
+                    {
+                        ++beginTo;
+                    }
+                    else
+                    {
+                        const ConstIterator from = beginFrom;
+                        beginTo = gallop(beginTo, endTo, [&isLess, from](ConstIterator to)
+                        {
+                            return !isLess(*from, *to);
+                        });
+                    }
+                }
+            }
+
+        }
+
+        // Cuts the longest run from the beginning of the detached sequence [begin, end) into run
+        // begin is moved to the rest of the sequence
+        // If isLess throws, every element is either in run (if run.length > 0) or in [begin, end)
+        template<typename LessCompare>
+        static void cutRun(Run &run, ConstIterator &begin, const ConstIterator end, LessCompare &isLess)
+        {
+            ConstIterator last = begin;
+            ConstIterator next = ::std::next(begin);
+            ::std::size_t length = 1;
+
+            // Strictly descending, so reversing the run keeps the sort stable
+            const bool descending = ((next != end) && isLess(*next, *last));
+
+            while ((next != end) && (descending ? isLess(*next, *last) : !isLess(*next, *last)))
+            {
+                prefetchNext(next);
+
+                last = next++;
+                ++length;
+            }
+
+            auto cutResult = cutSequence(begin, next);
+            begin = cutResult.end;
+
+            run.range = cutResult.cutted;
+            if (descending)
+            {
+                // Both ends of a detached sequence are linked to null, so it's the same sequence read backwards
+                run.range = { at<ConstIterator>(begin, Links::null(), run.range.second.prev),
+                              at<ConstIterator>(begin, run.range.first.current, Links::null()) };
+            }
+            run.length = length;
+
+            // Short runs are extended by insertion: cheaper than merging them while the nodes are still cached
+            // The place of a node is found before it's cut, so it stays in [begin, end) if isLess throws
+            for ( ; (run.length < minRunLength) && (begin != end); ++run.length)
+            {
+                ConstIterator position = run.range.second;
+                while ((position.prev != Links::null()) && isLess(*begin, *::std::prev(position)))
+                {
+                    --position;
+                }
+
+                const bool atBegin = (position.prev == Links::null());
+                const bool atEnd = (position.current == Links::null());
+
+                auto nodeCut = cutSequence(begin, ::std::next(begin));
+                begin = nodeCut.end;
+
+                auto inserted = insertNodeBefore(position, nodeCut.cutted.first.current);
+                if (atBegin)
+                {
+                    run.range.first = inserted.first;
+                }
+                if (atEnd)
+                {
+                    run.range.second = inserted.second;
+                }
+            }
+        }
+
+        // Merges the runs i and i + 1 into i
+        // If isLess throws, the run i holds the elements of both
+        template<typename LessCompare>
+        static void mergeRuns(::std::array<Run, 96> &runs, ::std::size_t &runCount, const ::std::size_t i,
+                              LessCompare &isLess)
+        {
+            Range &to = runs[i].range;
+            Range from = runs[i + 1].range;
+
+            try
+            {
+                mergeSteps(to.first, to.second, from.first, from.second, isLess);
+            }
+            catch (...)
+            {
+                if (from.first != from.second)
+                {
+                    to.second = insertSequenceBefore(to.second, from.first, from.second).second;
+                }
+                removeRun(runs, runCount, i + 1);
+                throw;
+            }
+
+            runs[i].length += runs[i + 1].length;
+            removeRun(runs, runCount, i + 1);
+        }
+
+        static void removeRun(::std::array<Run, 96> &runs, ::std::size_t &runCount, const ::std::size_t i) noexcept
+        {
+            for (::std::size_t j = i; j + 1 < runCount; ++j)
+            {
+                runs[j] = runs[j + 1];
+            }
+            --runCount;
+        }
+
+        // Links the runs and the rest of the detached sequence into one detached sequence
+        static Range concatenateRuns(const ::std::array<Run, 96> &runs, const ::std::size_t runCount,
+                                     const Range rest) noexcept
+        {
+            Range result = rest;
+
+            for (::std::size_t i = runCount; i > 0; --i)
+            {
+                const Range &run = runs[i - 1].range;
+
+                if (result.first != result.second)
+                {
+                    result.first = insertSequenceBefore(result.first, run.first, run.second).first;
+                }
+                else
+                {
+                    result = run;
+                }
+            }
+
+            return result;
+        }
+
+        // Restores the invariants length[i - 2] > length[i - 1] + length[i] and length[i - 1] > length[i]
+        //  for the top of the stack
+        template<typename LessCompare>
+        static void collapseRuns(::std::array<Run, 96> &runs, ::std::size_t &runCount, LessCompare &isLess)
+        {
+            while (runCount > 1)
+            {
+                const ::std::size_t n = runCount - 1;
+
+                if (((n >= 2) && (runs[n - 2].length <= runs[n - 1].length + runs[n].length))
+                    || ((n >= 3) && (runs[n - 3].length <= runs[n - 2].length + runs[n - 1].length)))
+                {
+                    mergeRuns(runs, runCount, (runs[n - 2].length < runs[n].length) ? (n - 2) : (n - 1), isLess);
+                }
+                else if (runs[n - 1].length <= runs[n].length)
+                {
+                    mergeRuns(runs, runCount, n - 1, isLess);
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+    };
+}
+
+#endif //XORLIST_XOR_LIST_DETAIL_H
@@ -0,0 +1,45 @@
+#ifndef XORLIST_XOR_LIST_HOOK_H
+#define XORLIST_XOR_LIST_HOOK_H
+
+#include "xor_list_detail.h" // xor_list_detail::Node
+
+
+class xor_list_hook;
+
+template<typename T, xor_list_hook T::*Hook>
+class xor_intrusive_list;
+
+
+// Embed into a type to link its objects into xor_intrusive_list
+// Copies of a hook are always unlinked
+class xor_list_hook : private xor_list_detail::Node
+{
+public:
+    xor_list_hook() noexcept
+        : xor_list_detail::Node()
+    {}
+
+    xor_list_hook(const xor_list_hook&) noexcept
+        : xor_list_detail::Node()
+    {}
+
+    ~xor_list_hook() = default;
+
+    xor_list_hook& operator=(const xor_list_hook&) noexcept
+    {
+        return *this;
+    }
+
+
+    // A linked hook always has two distinct neighbours, so its link is never zero
+    bool is_linked() const noexcept
+    {
+        return (xorPtr != 0);
+    }
+
+private:
+    template<typename T, xor_list_hook T::*Hook>
+    friend class xor_intrusive_list;
+};
+
+#endif //XORLIST_XOR_LIST_HOOK_H
@@ -0,0 +1,247 @@
+#ifndef XORLIST_XOR_POOL_ALLOCATOR_H
+#define XORLIST_XOR_POOL_ALLOCATOR_H
+
+#include <memory>           // ::std::shared_ptr, ::std::make_shared, ::std::unique_ptr
+#include <vector>           // ::std::vector
+#include <new>              // ::operator new, ::operator delete, ::std::bad_alloc
+#include <type_traits>      // ::std::true_type, ::std::false_type
+#include <cstddef>          // ::std::size_t, ::std::max_align_t
+#include <limits>           // ::std::numeric_limits
+
+
+namespace xor_pool_detail
+{
+    // Hands out blocks of one size carved from slabs of blocksPerSlab blocks
+    // Free blocks are linked through their first word
+    class FixedPool final
+    {
+    public:
+        FixedPool(::std::size_t blockSize, ::std::size_t blocksPerSlab) noexcept
+            : blockSize(blockSize), blocksPerSlab(blocksPerSlab)
+        {}
+
+        FixedPool(const FixedPool&) = delete;
+        FixedPool& operator=(const FixedPool&) = delete;
+
+        ~FixedPool()
+        {
+            while (slabs != nullptr)
+            {
+                Slab *const next = slabs->next;
+                ::operator delete(slabs);
+                slabs = next;
+            }
+        }
+
+
+        ::std::size_t block_size() const noexcept
+        {
+            return blockSize;
+        }
+
+        void* allocate()
+        {
+            if (freeBlocks != nullptr)
+            {
+                void *const result = freeBlocks;
+                freeBlocks = *static_cast<void**>(result);
+                return result;
+            }
+
+            if (unusedBegin == unusedEnd)
+            {
+                addSlab();
+            }
+
+            void *const result = unusedBegin;
+            unusedBegin += blockSize;
+            return result;
+        }
+
+        void deallocate(void *const block) noexcept
+        {
+            *static_cast<void**>(block) = freeBlocks;
+            freeBlocks = block;
+        }
+
+        // Blocks from first to last are already linked through their first word
+        void deallocate_chain(void *const first, void *const last) noexcept
+        {
+            *static_cast<void**>(last) = freeBlocks;
+            freeBlocks = first;
+        }
+
+    private:
+        struct Slab
+        {
+            Slab *next;
+        };
+
+        static constexpr ::std::size_t SlabHeaderSize =
+            (sizeof(Slab) + alignof(::std::max_align_t) - 1) / alignof(::std::max_align_t) * alignof(::std::max_align_t);
+
+
+        const ::std::size_t blockSize;
+        const ::std::size_t blocksPerSlab;
+        void *freeBlocks = nullptr;
+        // Blocks of the newest slab are carved lazily
+        char *unusedBegin = nullptr;
+        char *unusedEnd = nullptr;
+        Slab *slabs = nullptr;
+
+
+        void addSlab()
+        {
+            if (blocksPerSlab > (::std::numeric_limits<::std::size_t>::max() - SlabHeaderSize) / blockSize)
+            {
+                throw ::std::bad_alloc();
+            }
+
+            char *const memory = static_cast<char*>(::operator new(SlabHeaderSize + blockSize * blocksPerSlab));
+
+            Slab *const slab = reinterpret_cast<Slab*>(memory);
+            slab->next = slabs;
+            slabs = slab;
+
+            unusedBegin = memory + SlabHeaderSize;
+            unusedEnd = unusedBegin + blockSize * blocksPerSlab;
+        }
+    };
+
+    // Pools of all the types an allocator was rebound to, shared by its copies
+    class PoolSet final
+    {
+    public:
+        explicit PoolSet(::std::size_t blocksPerSlab) noexcept
+            : blocksPerSlab(blocksPerSlab)
+        {}
+
+        FixedPool& pool_for(::std::size_t size, ::std::size_t alignment)
+        {
+            if (alignment < alignof(void*))
+            {
+                alignment = alignof(void*);
+            }
+            if (size < sizeof(void*))
+            {
+                size = sizeof(void*);
+            }
+
+            const ::std::size_t blockSize = (size + alignment - 1) / alignment * alignment;
+
+            for (const auto &pool : pools)
+            {
+                if (pool->block_size() == blockSize)
+                {
+                    return *pool;
+                }
+            }
+
+            pools.emplace_back(new FixedPool(blockSize, blocksPerSlab));
+            return *pools.back();
+        }
+
+    private:
+        const ::std::size_t blocksPerSlab;
+        ::std::vector<::std::unique_ptr<FixedPool>> pools;
+    };
+}
+
+
+// Single-object allocations are served from slabs of BlocksPerSlab blocks, others go to ::operator new
+// Copies and rebound copies share the pools, memory is returned to the system when the last copy dies
+// WARNING! Not thread-safe: copies must not be used concurrently
+template<typename T, ::std::size_t BlocksPerSlab = 1024>
+class xor_pool_allocator
+{
+    static_assert(BlocksPerSlab > 0, "Slab must contain at least one block");
+    static_assert(alignof(T) <= alignof(::std::max_align_t), "Over-aligned types aren't supported");
+
+public:
+    using value_type = T;
+    using is_pooled = ::std::true_type;
+    using propagate_on_container_copy_assignment = ::std::false_type;
+    using propagate_on_container_move_assignment = ::std::true_type;
+    using propagate_on_container_swap = ::std::true_type;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = xor_pool_allocator<U, BlocksPerSlab>;
+    };
+
+
+    xor_pool_allocator()
+        : pools(::std::make_shared<xor_pool_detail::PoolSet>(BlocksPerSlab)),
+          pool(::std::addressof(pools->pool_for(sizeof(T), alignof(T))))
+    {}
+
+    template<typename U>
+    xor_pool_allocator(const xor_pool_allocator<U, BlocksPerSlab> &other)
+        : pools(other.pools), pool(::std::addressof(pools->pool_for(sizeof(T), alignof(T))))
+    {}
+
+    // No move operations: a moved-from allocator must stay usable
+    xor_pool_allocator(const xor_pool_allocator&) noexcept = default;
+    xor_pool_allocator& operator=(const xor_pool_allocator&) noexcept = default;
+
+    ~xor_pool_allocator() = default;
+
+
+    T* allocate(::std::size_t n)
+    {
+        if (n == 1)
+        {
+            return static_cast<T*>(pool->allocate());
+        }
+
+        if (n > ::std::numeric_limits<::std::size_t>::max() / sizeof(T))
+        {
+            throw ::std::bad_alloc();
+        }
+
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T *const p, ::std::size_t n) noexcept
+    {
+        if (n == 1)
+        {
+            pool->deallocate(p);
+        }
+        else
+        {
+            ::operator delete(p);
+        }
+    }
+
+    // Frees count single-object blocks at once in O(1)
+    // The blocks must be linked from first to last through a void* at their beginning
+    void deallocate_chain(T *const first, T *const last, ::std::size_t) noexcept
+    {
+        pool->deallocate_chain(first, last);
+    }
+
+
+    template<typename U>
+    bool operator==(const xor_pool_allocator<U, BlocksPerSlab> &right) const noexcept
+    {
+        return (pools == right.pools);
+    }
+
+    template<typename U>
+    bool operator!=(const xor_pool_allocator<U, BlocksPerSlab> &right) const noexcept
+    {
+        return !(*this == right);
+    }
+
+private:
+    template<typename U, ::std::size_t B>
+    friend class xor_pool_allocator;
+
+
+    ::std::shared_ptr<xor_pool_detail::PoolSet> pools;
+    xor_pool_detail::FixedPool *pool;
+};
+
+#endif //XORLIST_XOR_POOL_ALLOCATOR_H
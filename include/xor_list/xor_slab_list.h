@@ -0,0 +1,1261 @@
+#ifndef XORLIST_XOR_SLAB_LIST_H
+#define XORLIST_XOR_SLAB_LIST_H
+
+#include "xor_list_detail.h" // xor_list_detail::Sequences
+
+#include <initializer_list> // ::std::initializer_list
+#include <memory>           // ::std::allocator, ::std::allocator_traits, ::std::addressof
+#include <utility>          // ::std::move, ::std::forward, ::std::pair, ::std::move_if_noexcept
+#include <functional>       // ::std::less, ::std::equal_to
+#include <iterator>         // ::std::bidirectional_iterator_tag, ::std::next, ::std::iterator_traits
+#include <type_traits>      // ::std::enable_if, ::std::is_base_of, ::std::is_unsigned, ::std::aligned_storage
+#include <cstdint>          // ::std::uint32_t
+#include <cstddef>          // ::std::size_t, ::std::ptrdiff_t
+#include <algorithm>        // ::std::swap, ::std::equal, ::std::lexicographical_compare, ::std::min
+#include <tuple>            // ::std::tie
+#include <limits>           // ::std::numeric_limits
+#include <stdexcept>        // ::std::length_error
+
+
+// XOR linked list whose nodes live in one growable array (slab) and are linked by
+//  index(prev) ^ index(next) stored in TIndex (32 bits by default) instead of a pointer.
+// Iterators stay valid when the slab grows, but pointers and references to elements don't.
+// Iterators hold a pointer to the list, so unlike xor_list iterators they are invalidated by move and swap.
+// Relinking algorithms (sort, merge, splice and reverse inside the list) are shared with xor_list;
+//  nodes can't be shared between slabs, so splice/merge from another list move the elements.
+template<typename T, class TAllocator = ::std::allocator<T>, typename TIndex = ::std::uint32_t>
+class xor_slab_list
+{
+    static_assert(::std::is_unsigned<TIndex>::value, "Index type must be unsigned integer");
+
+private:
+    template<typename It, typename V>
+    class IteratorBase;
+
+    struct Links;
+
+public:
+    class const_iterator;
+
+    class iterator : public IteratorBase<iterator, T>
+    {
+    public:
+        iterator() noexcept = default;
+        iterator(const iterator&) noexcept = default;
+        iterator(iterator&&) noexcept = default;
+
+        ~iterator() noexcept = default;
+
+        iterator& operator=(const iterator&) noexcept = default;
+        iterator& operator=(iterator&&) noexcept = default;
+
+
+        operator const_iterator() const noexcept
+        {
+            return { this->list, this->prev, this->current };
+        }
+
+    private:
+        friend class xor_slab_list<T, TAllocator, TIndex>;
+        friend class const_iterator;
+        friend struct xor_list_detail::Sequences<iterator, const_iterator, Links>;
+
+
+        iterator(xor_slab_list *list, TIndex prev, TIndex current) noexcept
+            : IteratorBase<iterator, T>(list, prev, current)
+        {
+        }
+    };
+
+    class const_iterator : public IteratorBase<const_iterator, const T>
+    {
+    public:
+        const_iterator() noexcept = default;
+        const_iterator(const const_iterator&) noexcept = default;
+        const_iterator(const_iterator&&) noexcept = default;
+
+        ~const_iterator() noexcept = default;
+
+        const_iterator& operator=(const const_iterator&) noexcept = default;
+        const_iterator& operator=(const_iterator&&) noexcept = default;
+
+    private:
+        friend class xor_slab_list<T, TAllocator, TIndex>;
+        friend class iterator;
+        friend struct xor_list_detail::Sequences<iterator, const_iterator, Links>;
+
+
+        const_iterator(xor_slab_list *list, TIndex prev, TIndex current) noexcept
+            : IteratorBase<const_iterator, const T>(list, prev, current)
+        {
+        }
+
+        explicit operator iterator() const noexcept
+        {
+            return { this->list, this->prev, this->current };
+        }
+    };
+
+    using value_type = T;
+    using allocator_type = TAllocator;
+    using size_type = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = typename ::std::allocator_traits<TAllocator>::pointer;
+    using const_pointer = typename ::std::allocator_traits<TAllocator>::const_pointer;
+    using index_type = TIndex;
+
+
+    xor_slab_list()
+        : xor_slab_list(TAllocator())
+    {}
+
+    explicit xor_slab_list(const TAllocator &alloc)
+        : allocator(alloc)
+    {}
+
+    xor_slab_list(::std::initializer_list<T> il, const TAllocator &alloc = TAllocator())
+        : xor_slab_list(alloc)
+    {
+        assign(::std::move(il));
+    }
+
+    explicit xor_slab_list(size_type n, const TAllocator &alloc = TAllocator())
+        : xor_slab_list(alloc)
+    {
+        resize(n);
+    }
+
+    xor_slab_list(size_type n, const_reference val, const TAllocator &alloc = TAllocator())
+        : xor_slab_list(alloc)
+    {
+        resize(n, val);
+    }
+
+    xor_slab_list(const xor_slab_list &other)
+        : xor_slab_list(::std::allocator_traits<SlotAllocator>::select_on_container_copy_construction(other.allocator))
+    {
+        reserve(other.size());
+        insert(cbegin(), other.cbegin(), other.cend());
+    }
+
+    // Iterators of other will become invalid: they refer to the list object
+    xor_slab_list(xor_slab_list &&other)
+        : allocator(::std::move(other.allocator))
+    {
+        swapSlabs(other);
+    }
+
+    ~xor_slab_list()
+    {
+        clear();
+        deallocateSlab(slots, slabCapacity);
+    }
+
+    xor_slab_list& operator=(const xor_slab_list &right)
+    {
+        if (this != ::std::addressof(right))
+        {
+            copyAssignmentImpl(right);
+        }
+        return *this;
+    }
+
+    xor_slab_list& operator=(xor_slab_list &&right)
+    {
+        if (this != ::std::addressof(right))
+        {
+            moveAssignmentImpl(::std::move(right));
+        }
+        return *this;
+    }
+
+    allocator_type get_allocator() const
+    {
+        return allocator_type(allocator);
+    }
+
+    // Iterators of both lists will become invalid: they refer to the list object
+    void swap(xor_slab_list &other)
+    {
+        swapImpl(other);
+    }
+
+    void push_back(const_reference data)
+    {
+        emplace_back(data);
+    }
+
+    void push_back(T &&data)
+    {
+        emplace_back(::std::move(data));
+    }
+
+    void push_front(const_reference data)
+    {
+        emplace_front(data);
+    }
+
+    void push_front(T &&data)
+    {
+        emplace_front(::std::move(data));
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        (void)emplace(cend(), ::std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    void emplace_front(Args&&... args)
+    {
+        (void)emplace(cbegin(), ::std::forward<Args>(args)...);
+    }
+
+    void pop_front()
+    {
+        (void)erase(cbegin());
+    }
+
+    void pop_back()
+    {
+        (void)erase(--cend());
+    }
+
+    size_type size() const noexcept
+    {
+        return length;
+    }
+
+    size_type max_size() const noexcept
+    {
+        return (::std::min)(static_cast<size_type>(::std::numeric_limits<TIndex>::max() - FirstNode),
+                            ::std::numeric_limits<size_type>::max() / sizeof(Slot) - FirstNode);
+    }
+
+    bool empty() const noexcept
+    {
+        return (size() == 0);
+    }
+
+    // Number of elements the slab can hold without growing
+    size_type capacity() const noexcept
+    {
+        return (slabCapacity > FirstNode) ? (slabCapacity - FirstNode) : 0;
+    }
+
+    // Grows the slab to hold at least n elements
+    // Iterators remain valid, pointers and references to the elements will become invalid
+    // strong exception-safe guarantee
+    void reserve(size_type n)
+    {
+        if (n > capacity())
+        {
+            if (n > max_size())
+            {
+                throw ::std::length_error("xor_slab_list::reserve");
+            }
+
+            reallocateSlab(n + FirstNode);
+        }
+    }
+
+    // Keeps the slab allocated
+    void clear()
+    {
+        destroySequence(cbegin(), cend(), size());
+
+        usedSlots = FirstNode;
+        freeSlots = NullIndex;
+    }
+
+    T& back()
+    {
+        return *(--end());
+    }
+
+    const T& back() const
+    {
+        return *(--cend());
+    }
+
+    T& front()
+    {
+        return *begin();
+    }
+
+    const T& front() const
+    {
+        return *cbegin();
+    }
+
+    // Iterators and such
+    iterator begin() noexcept
+    {
+        return { this, BeforeHead, firstIndex() };
+    }
+
+    iterator end() noexcept
+    {
+        return { this, lastIndex(), AfterTail };
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return { const_cast<xor_slab_list*>(this), BeforeHead, firstIndex() };
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return { const_cast<xor_slab_list*>(this), lastIndex(), AfterTail };
+    }
+
+    void sort()
+    {
+        sort(::std::less<T>{});
+    }
+
+    // Stable natural merge sort shared with xor_list (see xor_list_detail::Sequences::sortSequence)
+    // If isLess throws, the list keeps all its elements in unspecified order
+    template<typename Compare>
+    void sort(Compare isLess)
+    {
+        const auto thisSize = size();
+
+        if (thisSize < 2)
+        {
+            return;
+        }
+
+        typename Sequences::Range sequence = cutSequenceFromThis(cbegin(), cend(), thisSize).cutted;
+
+        try
+        {
+            Sequences::sortSequence(sequence, isLess);
+        }
+        catch (...)
+        {
+            (void)insertSequenceToThisBefore(cend(), sequence.first, sequence.second, thisSize);
+            throw;
+        }
+
+        (void)insertSequenceToThisBefore(cend(), sequence.first, sequence.second, thisSize);
+    }
+
+    // WARNING! Iterators equal to position will become invalid
+    // strong exception-safe guarantee
+    iterator insert(const_iterator position, const_reference val)
+    {
+        return emplace(position, val);
+    }
+
+    // WARNING! Iterators equal to position will become invalid
+    // strong exception-safe guarantee
+    template<typename InputIterator>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last)
+    {
+        if (first == last)
+        {
+            return static_cast<iterator>(position);
+        }
+
+        const iterator result = insert(position, *first);
+        position = result;
+        size_type insertedCount = 1;
+
+        for (++position ; ++first != last; ++position, ++insertedCount)
+        {
+            try
+            {
+                position = insert(position, *first);
+            }
+            catch(...)
+            {
+                destroySequence(result, position, insertedCount);
+                throw;
+            }
+        }
+
+        return result;
+    }
+
+    // WARNING! Iterators equal to position will become invalid
+    // strong exception-safe guarantee
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+        //insertNodeToThisBefore noexcept!
+        return insertNodeToThisBefore(position, createNode(::std::forward<Args>(args)...)).first;
+    }
+
+    // WARNING! All iterators will become invalid
+    // Complexity: O(1)
+    void reverse() noexcept
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        const TIndex first = firstIndex();
+        const TIndex last = lastIndex();
+
+        link(first) = link(first) ^ BeforeHead ^ AfterTail;
+        link(last) = link(last) ^ AfterTail ^ BeforeHead;
+
+        link(BeforeHead) = last;
+        link(AfterTail) = first;
+    }
+
+    // WARNING! Iterators in the range [position, position + 1] will become invalid
+    iterator erase(const_iterator position)
+    {
+        return erase(position, ::std::next(position));
+    }
+
+    // WARNING! Iterators in the range [first, last] will become invalid
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        if (first != last)
+        {
+            destroySequence(first, last, ::std::distance(first, last));
+        }
+
+        return { this, first.prev, last.current };
+    }
+
+    size_type remove(const T &value)
+    {
+        return remove_if([&value](const T &elem) { return (elem == value); });
+    }
+
+    template<typename UnaryPredicate>
+    size_type remove_if(UnaryPredicate p)
+    {
+        size_type result = 0;
+
+        for (const_iterator iter = cbegin(); iter != cend();)
+        {
+            if (p(*iter))
+            {
+                iter = erase(iter);
+                ++result;
+            }
+            else
+            {
+                ++iter;
+            }
+        }
+
+        return result;
+    }
+
+    void resize(size_type count)
+    {
+        resizeImpl(count);
+    }
+
+    void resize(size_type count, const_reference val)
+    {
+        resizeImpl(count, val);
+    }
+
+    template<typename InputIterator>
+    typename ::std::enable_if<::std::is_base_of<::std::input_iterator_tag,
+                                                typename ::std::iterator_traits<InputIterator>::iterator_category>::value>::type
+    assign(InputIterator first, InputIterator last)
+    {
+        for (auto iter = begin(); iter != end(); ++iter, ++first)
+        {
+            if (first == last)
+            {
+                (void)erase(iter, end());
+                return;
+            }
+
+            *iter = *first;
+        }
+
+        for ( ; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    void assign(size_type count, const_reference val)
+    {
+        auto iter = begin();
+        for ( ; (iter != end()) && (count > 0); ++iter, --count)
+        {
+           *iter = val;
+        }
+
+        if (iter != end())
+        {
+            erase(iter, end());
+        }
+        else
+        {
+            while (count > 0)
+            {
+                emplace_back(val);
+                --count;
+            }
+        }
+    }
+
+    void assign(::std::initializer_list<T> il)
+    {
+        assign(il.begin(), il.end());
+    }
+
+
+    // Elements of x are moved into this slab
+    // strong exception-safe guarantee
+    void splice(const_iterator position, xor_slab_list &x)
+    {
+        if ((this == ::std::addressof(x)) || (x.empty()))
+        {
+            return;
+        }
+
+        splice(position, x, x.cbegin(), x.cend());
+    }
+
+    // The element is relinked if x is *this and moved otherwise
+    void splice(const_iterator position, xor_slab_list &x, const_iterator i)
+    {
+        if (this != ::std::addressof(x))
+        {
+            (void)emplace(position, ::std::move(*static_cast<iterator>(i)));
+            (void)x.erase(i);
+            return;
+        }
+
+        if ((position == i) || (position.prev == i.current))
+        {
+            return;
+        }
+
+        const auto range = cutSequence(i, ::std::next(i)).cutted;
+        (void)insertNodeBefore(position, range.first.current);
+    }
+
+    // Elements are relinked in O(1) if x is *this and moved otherwise
+    void splice(const_iterator position, xor_slab_list &x, const_iterator first, const_iterator last)
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        if (this == ::std::addressof(x))
+        {
+            ::std::tie(first, last) = cutSequence(first, last).cutted;
+            (void)insertSequenceBefore(position, first, last);
+            return;
+        }
+
+        const auto distance = ::std::distance(first, last);
+        const auto moved = moveSequenceFrom(first, last, distance);
+        (void)insertSequenceToThisBefore(position, moved.first, moved.second, distance);
+        (void)x.erase(first, last);
+    }
+
+    // All iterators will become invalid
+    void unique()
+    {
+        unique(::std::equal_to<T>{});
+    }
+
+    // All iterators will become invalid
+    template<typename BinaryPredicate>
+    void unique(BinaryPredicate isEqual)
+    {
+        if (size() < 2)
+        {
+            return;
+        }
+
+        auto current = cbegin();
+        for (auto prev = current++; current != cend(); )
+        {
+            if (isEqual(*prev, *current))
+            {
+                current = erase(current);
+            }
+            else
+            {
+                prev = current++;
+            }
+        }
+    }
+
+    // All iterators from *this and x will become invalid
+    void merge(xor_slab_list &x)
+    {
+        merge(x, ::std::less<T>{});
+    }
+
+    // All iterators from *this and x will become invalid
+    // Elements of x are moved into this slab first, then relinked
+    template<typename Compare>
+    void merge(xor_slab_list &x, Compare isLess)
+    {
+        if ((this == ::std::addressof(x)) || (x.empty()))
+        {
+            return;
+        }
+
+        const auto distance = x.size();
+        const auto range = moveSequenceFrom(x.cbegin(), x.cend(), distance);
+        x.clear();
+
+        (void)mergeSequencesToThis(cbegin(), cend(), range.first, range.second, ::std::move(isLess), distance);
+    }
+
+private:
+    // Slot 0 is the null index, slots 1 and 2 are the sentinels
+    static constexpr TIndex NullIndex = 0;
+    static constexpr TIndex BeforeHead = 1;
+    static constexpr TIndex AfterTail = 2;
+    static constexpr TIndex FirstNode = 3;
+
+
+    struct Slot
+    {
+        TIndex xorIndex;
+        typename ::std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+
+
+        T* value() noexcept
+        {
+            return reinterpret_cast<T*>(::std::addressof(storage));
+        }
+    };
+
+
+    #ifdef _MSC_VER
+    using SlotAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<Slot>;
+    #else
+    using SlotAllocator = typename ::std::allocator_traits<TAllocator>::template rebind_alloc<Slot>;
+    #endif
+
+
+    template<typename It, typename V>
+    class IteratorBase
+    {
+    public:
+        // =========================== Iterator Concept ===============================
+        using difference_type = ::std::ptrdiff_t;
+        using value_type = V;
+        using pointer = value_type*;
+        using reference = value_type&;
+        using iterator_category = ::std::bidirectional_iterator_tag;
+
+
+        reference operator*() const
+        {
+            return *list->slots[current].value();
+        }
+
+        It& operator++()
+        {
+            TIndex next = prev ^ list->linkOf(current);
+
+            prev = current;
+            current = next;
+
+            return static_cast<It&>(*this);
+        }
+        // ======================== End Iterator Concept ==============================
+
+        // ====================== Input/Forward Iterator Concept ======================
+        bool operator==(const It &right) const noexcept
+        {
+            return (current == right.current);
+        }
+
+        bool operator!=(const It &right) const noexcept
+        {
+            return !(*this == right);
+        }
+
+        pointer operator->() const
+        {
+            return list->slots[current].value();
+        }
+
+        It operator++(int)
+        {
+            It result(static_cast<It&>(*this));
+            (void)++(*this);
+            return result;
+        }
+        // ==================== End Input/Forward Iterator Concept ====================
+
+        // ===================== Bidirectional Iterator Concept =======================
+        It& operator--()
+        {
+            TIndex newPrev = list->linkOf(prev) ^ current;
+
+            current = prev;
+            prev = newPrev;
+
+            return static_cast<It&>(*this);
+        }
+
+        It operator--(int)
+        {
+            It result(static_cast<It&>(*this));
+            (void)--(*this);
+            return result;
+        }
+        // =================== End Bidirectional Iterator Concept =====================
+    protected:
+        xor_slab_list *list;
+        TIndex prev;
+        TIndex current;
+
+
+        IteratorBase(xor_slab_list *list = nullptr, TIndex prev = NullIndex, TIndex current = NullIndex) noexcept
+            : list(list), prev(prev), current(current)
+        {
+        }
+
+        IteratorBase(const IteratorBase&) noexcept = default;
+        IteratorBase(IteratorBase&&) noexcept = default;
+
+        ~IteratorBase() noexcept = default;
+
+        IteratorBase& operator=(const IteratorBase&) noexcept = default;
+        IteratorBase& operator=(IteratorBase&&) noexcept = default;
+
+    private:
+        friend class xor_slab_list<T, TAllocator, TIndex>;
+        friend struct xor_list_detail::Sequences<iterator, const_iterator, Links>;
+    };
+
+
+    // Nodes are addressed by their slot indices, the iterators know the slab
+    struct Links final
+    {
+        using Index = TIndex;
+        using Link = TIndex;
+
+
+        static Index null() noexcept
+        {
+            return NullIndex;
+        }
+
+        static Link& link(const const_iterator &context, const TIndex node) noexcept
+        {
+            return context.list->slots[node].xorIndex;
+        }
+
+        static Link value(const TIndex node) noexcept
+        {
+            return node;
+        }
+
+        static Index index(const Link link) noexcept
+        {
+            return link;
+        }
+
+        static const void* address(const const_iterator &context, const TIndex node) noexcept
+        {
+            return context.list->slots + node;
+        }
+    };
+
+    using Sequences = xor_list_detail::Sequences<iterator, const_iterator, Links>;
+    using CutResult = typename Sequences::CutResult;
+
+
+    SlotAllocator allocator;
+    Slot *slots = nullptr;
+    size_type slabCapacity = 0;
+    // Slots [FirstNode, usedSlots) have ever been handed out, the released ones form a list through freeSlots
+    size_type usedSlots = FirstNode;
+    TIndex freeSlots = NullIndex;
+    size_type length = 0;
+
+
+    TIndex& link(TIndex index) noexcept
+    {
+        return slots[index].xorIndex;
+    }
+
+    // The slab is allocated lazily, so the sentinels of an empty list may not exist yet;
+    // without it they are linked to each other
+    TIndex linkOf(TIndex index) const noexcept
+    {
+        if (slots == nullptr)
+        {
+            return (index == BeforeHead) ? AfterTail : BeforeHead;
+        }
+
+        return slots[index].xorIndex;
+    }
+
+    TIndex firstIndex() const noexcept
+    {
+        return linkOf(BeforeHead);
+    }
+
+    TIndex lastIndex() const noexcept
+    {
+        return linkOf(AfterTail);
+    }
+
+
+    Slot* allocateSlab(size_type capacity)
+    {
+        return ::std::allocator_traits<SlotAllocator>::allocate(allocator, capacity);
+    }
+
+    void deallocateSlab(Slot *const slab, size_type capacity)
+    {
+        if (slab != nullptr)
+        {
+            ::std::allocator_traits<SlotAllocator>::deallocate(allocator, slab, capacity);
+        }
+    }
+
+    // Moves alive elements into newSlots (at the same indices) and replaces the slab by it
+    // Links are copied as is, so iterators remain valid
+    // strong exception-safe guarantee (newSlots is left to the caller on exception)
+    void relocateSlab(Slot *const newSlots, size_type newCapacity)
+    {
+        if (slots == nullptr)
+        {
+            newSlots[NullIndex].xorIndex = NullIndex;
+            newSlots[BeforeHead].xorIndex = AfterTail;
+            newSlots[AfterTail].xorIndex = BeforeHead;
+
+            slots = newSlots;
+            slabCapacity = newCapacity;
+            return;
+        }
+
+        for (size_type i = 0; i < usedSlots; ++i)
+        {
+            newSlots[i].xorIndex = slots[i].xorIndex;
+        }
+
+        const_iterator relocated = cbegin();
+        try
+        {
+            for ( ; relocated != cend(); ++relocated)
+            {
+                ::std::allocator_traits<SlotAllocator>::construct(allocator, newSlots[relocated.current].value(),
+                                                                  ::std::move_if_noexcept(*static_cast<iterator>(relocated)));
+            }
+        }
+        catch (...)
+        {
+            for (auto iter = cbegin(); iter != relocated; ++iter)
+            {
+                ::std::allocator_traits<SlotAllocator>::destroy(allocator, newSlots[iter.current].value());
+            }
+
+            throw;
+        }
+
+        for (auto iter = cbegin(); iter != cend(); ++iter)
+        {
+            ::std::allocator_traits<SlotAllocator>::destroy(allocator, slots[iter.current].value());
+        }
+
+        deallocateSlab(slots, slabCapacity);
+
+        slots = newSlots;
+        slabCapacity = newCapacity;
+    }
+
+    void reallocateSlab(size_type newCapacity)
+    {
+        Slot *const newSlots = allocateSlab(newCapacity);
+
+        try
+        {
+            relocateSlab(newSlots, newCapacity);
+        }
+        catch (...)
+        {
+            deallocateSlab(newSlots, newCapacity);
+            throw;
+        }
+    }
+
+    size_type grownCapacity() const
+    {
+        if (usedSlots - FirstNode >= max_size())
+        {
+            throw ::std::length_error("xor_slab_list");
+        }
+
+        const size_type minCapacity = usedSlots + 1;
+        const size_type maxCapacity = max_size() + FirstNode;
+        const size_type doubled = (slabCapacity < 8) ? 16 : slabCapacity * 2;
+
+        return (::std::max)(minCapacity, (::std::min)(doubled, maxCapacity));
+    }
+
+
+    template<typename... Args>
+    TIndex createNode(Args&&... args)
+    {
+        if (freeSlots != NullIndex)
+        {
+            const TIndex result = freeSlots;
+            ::std::allocator_traits<SlotAllocator>::construct(allocator, slots[result].value(),
+                                                              ::std::forward<Args>(args)...);
+            freeSlots = slots[result].xorIndex;
+            return result;
+        }
+
+        if (usedSlots < slabCapacity)
+        {
+            ::std::allocator_traits<SlotAllocator>::construct(allocator, slots[usedSlots].value(),
+                                                              ::std::forward<Args>(args)...);
+            return static_cast<TIndex>(usedSlots++);
+        }
+
+        const size_type newCapacity = grownCapacity();
+        Slot *const newSlots = allocateSlab(newCapacity);
+
+        // The element is constructed before relocation: args may refer to the elements of this list
+        try
+        {
+            ::std::allocator_traits<SlotAllocator>::construct(allocator, newSlots[usedSlots].value(),
+                                                              ::std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            deallocateSlab(newSlots, newCapacity);
+            throw;
+        }
+
+        try
+        {
+            relocateSlab(newSlots, newCapacity);
+        }
+        catch (...)
+        {
+            ::std::allocator_traits<SlotAllocator>::destroy(allocator, newSlots[usedSlots].value());
+            deallocateSlab(newSlots, newCapacity);
+            throw;
+        }
+
+        return static_cast<TIndex>(usedSlots++);
+    }
+
+    void destroyNode(TIndex node)
+    {
+        ::std::allocator_traits<SlotAllocator>::destroy(allocator, slots[node].value());
+
+        slots[node].xorIndex = freeSlots;
+        freeSlots = node;
+    }
+
+
+    ::std::pair<iterator, iterator>
+    insertNodeToThisBefore(const_iterator position, TIndex node) noexcept
+    {
+        ++length;
+        return insertNodeBefore(position, node);
+    }
+
+    ::std::pair<iterator, iterator>
+    insertNodeBefore(const_iterator position, TIndex node) noexcept
+    {
+        return Sequences::insertNodeBefore(position, node);
+    }
+
+
+    template<typename I>
+    ::std::pair<iterator, iterator>
+    insertSequenceToThisBefore(const_iterator position, const_iterator begin,
+                               const_iterator end, I distance) noexcept
+    {
+        length += distance;
+        return insertSequenceBefore(position, begin, end);
+    }
+
+    ::std::pair<iterator, iterator>
+    insertSequenceBefore(const_iterator position, const_iterator begin,
+                         const_iterator end) noexcept
+    {
+        return Sequences::insertSequenceBefore(position, begin, end);
+    }
+
+
+    template<typename I>
+    CutResult
+    cutSequenceFromThis(const_iterator first, const_iterator last, I distance) noexcept
+    {
+        length -= distance;
+        return cutSequence(first, last);
+    }
+
+    CutResult
+    cutSequence(const_iterator begin, const_iterator end) noexcept
+    {
+        return Sequences::cutSequence(begin, end);
+    }
+
+
+    template<typename I>
+    void destroySequence(const_iterator begin, const_iterator end, I distance)
+    {
+        if (distance == 0)
+        {
+            return;
+        }
+
+        ::std::tie(begin, end) = cutSequenceFromThis(begin, end, distance).cutted; // noexcept!
+
+        for (; begin != end; )
+        {
+            destroyNode((++begin).prev);
+        }
+    }
+
+    // Moves <distance> elements [first, last) of another list into the detached sequence of this slab
+    // Returns the sequence in the form of cutSequence().cutted
+    // strong exception-safe guarantee
+    template<typename I>
+    ::std::pair<const_iterator, const_iterator>
+    moveSequenceFrom(const_iterator first, const_iterator last, I distance)
+    {
+        // The slab is grown up front: relocation moves only the linked elements, not the detached ones
+        reserve(size() + distance);
+
+        const_iterator begin{ this, NullIndex, NullIndex };
+        const_iterator end = begin;
+
+        try
+        {
+            for ( ; first != last; ++first)
+            {
+                const TIndex node = createNode(::std::move_if_noexcept(*static_cast<iterator>(first)));
+
+                if (begin.current == NullIndex)
+                {
+                    begin.current = node;
+                }
+
+                end = insertNodeBefore(end, node).second;
+            }
+        }
+        catch (...)
+        {
+            if (begin.current != NullIndex)
+            {
+                for (; begin != end; )
+                {
+                    destroyNode((++begin).prev);
+                }
+            }
+
+            throw;
+        }
+
+        return { begin, end };
+    }
+
+
+    void swapSlabs(xor_slab_list &other) noexcept
+    {
+        ::std::swap(slots, other.slots);
+        ::std::swap(slabCapacity, other.slabCapacity);
+        ::std::swap(usedSlots, other.usedSlots);
+        ::std::swap(freeSlots, other.freeSlots);
+        ::std::swap(length, other.length);
+    }
+
+    template<typename Alloc = SlotAllocator>
+    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_swap::value>::type
+    swapImpl(xor_slab_list &other)
+    {
+        ::std::swap(allocator, other.allocator);
+        swapSlabs(other);
+    }
+
+    template<typename Alloc = SlotAllocator>
+    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_swap::value>::type
+    swapImpl(xor_slab_list &other)
+    {
+        swapSlabs(other);
+    }
+
+
+    template<typename Alloc = SlotAllocator>
+    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value>::type
+    copyAssignmentImpl(const xor_slab_list &right)
+    {
+        clear();
+
+        if (!(allocator == right.allocator))
+        {
+            deallocateSlab(slots, slabCapacity);
+            slots = nullptr;
+            slabCapacity = 0;
+        }
+
+        allocator = right.allocator;
+        assign(right.cbegin(), right.cend());
+    }
+
+    template<typename Alloc = SlotAllocator>
+    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value>::type
+    copyAssignmentImpl(const xor_slab_list &right)
+    {
+        clear();
+        assign(right.cbegin(), right.cend());
+    }
+
+
+    template<typename Alloc = SlotAllocator>
+    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value>::type
+    moveAssignmentImpl(xor_slab_list &&right)
+    {
+        clear();
+        deallocateSlab(slots, slabCapacity);
+        slots = nullptr;
+        slabCapacity = 0;
+
+        allocator = ::std::move(right.allocator);
+        swapSlabs(right);
+    }
+
+    template<typename Alloc = SlotAllocator>
+    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value>::type
+    moveAssignmentImpl(xor_slab_list &&right)
+    {
+        clear();
+
+        if (allocator == right.allocator)
+        {
+            deallocateSlab(slots, slabCapacity);
+            slots = nullptr;
+            slabCapacity = 0;
+
+            swapSlabs(right);
+        }
+        else
+        {
+            for (T &moved : right)
+            {
+                emplace_back(::std::move(moved));
+            }
+
+            right.clear();
+        }
+    }
+
+
+    template<typename... Args>
+    void resizeImpl(size_type count, Args&&... args)
+    {
+        if (count == 0)
+        {
+            clear();
+            return;
+        }
+
+        while (size() > count)
+        {
+            pop_back();
+        }
+
+        if (size() < count)
+        {
+            reserve(count);
+        }
+
+        while (size() < count)
+        {
+            emplace_back(::std::forward<Args>(args)...);
+        }
+    }
+
+
+    template<typename LessCompare, typename I>
+    ::std::pair<iterator, iterator>
+    mergeSequencesToThis(const_iterator beginTo, const_iterator endTo,
+                         const_iterator beginFrom, const_iterator endFrom,
+                         LessCompare &&isLess, I distance) noexcept
+    {
+        length += distance;
+        return Sequences::mergeSequences(beginTo, endTo, beginFrom, endFrom, ::std::forward<LessCompare>(isLess));
+    }
+};
+
+template<typename T, class TAllocator, typename TIndex>
+constexpr TIndex xor_slab_list<T, TAllocator, TIndex>::NullIndex;
+
+template<typename T, class TAllocator, typename TIndex>
+constexpr TIndex xor_slab_list<T, TAllocator, TIndex>::BeforeHead;
+
+template<typename T, class TAllocator, typename TIndex>
+constexpr TIndex xor_slab_list<T, TAllocator, TIndex>::AfterTail;
+
+template<typename T, class TAllocator, typename TIndex>
+constexpr TIndex xor_slab_list<T, TAllocator, TIndex>::FirstNode;
+
+
+// Comparison operators
+
+template<typename T, class TAllocator, typename TIndex>
+bool operator==(const xor_slab_list<T, TAllocator, TIndex> &lhs, const xor_slab_list<T, TAllocator, TIndex> &rhs)
+{
+    return ((lhs.size() == rhs.size()) && (::std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin())));
+}
+
+template<typename T, class TAllocator, typename TIndex>
+bool operator!=(const xor_slab_list<T, TAllocator, TIndex> &lhs, const xor_slab_list<T, TAllocator, TIndex> &rhs)
+{
+    return (!(lhs == rhs));
+}
+
+template<typename T, class TAllocator, typename TIndex>
+bool operator<(const xor_slab_list<T, TAllocator, TIndex> &lhs, const xor_slab_list<T, TAllocator, TIndex> &rhs)
+{
+    return ::std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+template<typename T, class TAllocator, typename TIndex>
+bool operator>(const xor_slab_list<T, TAllocator, TIndex> &lhs, const xor_slab_list<T, TAllocator, TIndex> &rhs)
+{
+    return (rhs < lhs);
+}
+
+template<typename T, class TAllocator, typename TIndex>
+bool operator<=(const xor_slab_list<T, TAllocator, TIndex> &lhs, const xor_slab_list<T, TAllocator, TIndex> &rhs)
+{
+    return (!(rhs < lhs));
+}
+
+template<typename T, class TAllocator, typename TIndex>
+bool operator>=(const xor_slab_list<T, TAllocator, TIndex> &lhs, const xor_slab_list<T, TAllocator, TIndex> &rhs)
+{
+    return (!(lhs < rhs));
+}
+
+#endif //XORLIST_XOR_SLAB_LIST_H
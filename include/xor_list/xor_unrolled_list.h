@@ -0,0 +1,1790 @@
+#ifndef XORLIST_XOR_UNROLLED_LIST_H
+#define XORLIST_XOR_UNROLLED_LIST_H
+
+#include "xor_list_detail.h" // xor_list_detail
+
+#include <initializer_list> // ::std::initializer_list
+#include <memory>           // ::std::allocator, ::std::allocator_traits, ::std::addressof
+#include <utility>          // ::std::move, ::std::forward, ::std::move_if_noexcept
+#include <functional>       // ::std::less, ::std::equal_to
+#include <iterator>         // ::std::bidirectional_iterator_tag, ::std::next, ::std::prev, ::std::distance
+#include <type_traits>      // ::std::enable_if, ::std::is_base_of, ::std::aligned_storage
+#include <cstdint>          // ::std::uint*_t
+#include <cstddef>          // ::std::size_t, ::std::ptrdiff_t
+#include <algorithm>        // ::std::equal, ::std::lexicographical_compare, ::std::remove_if, ::std::unique, ...
+#include <array>            // ::std::array
+#include <limits>           // ::std::numeric_limits
+
+
+// XOR linked list of chunks, each chunk stores up to ChunkCapacity elements inline.
+// T must be MoveInsertable and MoveAssignable: elements are shifted inside chunks
+//  and relocated between chunks on insert/erase/splice/sort/merge.
+// Unlike xor_list, modifications (except push/pop at the ends) may invalidate iterators
+//  to the elements of the affected chunks.
+template<typename T, ::std::size_t ChunkCapacity = 16, class TAllocator = ::std::allocator<T>>
+class xor_unrolled_list
+{
+    static_assert(ChunkCapacity > 1, "Chunk must be able to store at least 2 elements");
+
+private:
+    template<typename It, typename V>
+    class IteratorBase;
+
+    // Chunks are linked the same way as xor_list nodes
+    using Link = xor_list_detail::Node;
+
+public:
+    class const_iterator;
+
+    class iterator : public IteratorBase<iterator, T>
+    {
+    public:
+        iterator() noexcept = default;
+        iterator(const iterator&) noexcept = default;
+        iterator(iterator&&) noexcept = default;
+
+        ~iterator() noexcept = default;
+
+        iterator& operator=(const iterator&) noexcept = default;
+        iterator& operator=(iterator&&) noexcept = default;
+
+
+        operator const_iterator() const noexcept
+        {
+            return { this->prev, this->current, this->index };
+        }
+
+    private:
+        friend class xor_unrolled_list<T, ChunkCapacity, TAllocator>;
+        friend class const_iterator;
+
+
+        iterator(Link *prev, Link *current, ::std::size_t index) noexcept
+            : IteratorBase<iterator, T>(prev, current, index)
+        {
+        }
+    };
+
+    class const_iterator : public IteratorBase<const_iterator, const T>
+    {
+    public:
+        const_iterator() noexcept = default;
+        const_iterator(const const_iterator&) noexcept = default;
+        const_iterator(const_iterator&&) noexcept = default;
+
+        ~const_iterator() noexcept = default;
+
+        const_iterator& operator=(const const_iterator&) noexcept = default;
+        const_iterator& operator=(const_iterator&&) noexcept = default;
+
+    private:
+        friend class xor_unrolled_list<T, ChunkCapacity, TAllocator>;
+        friend class iterator;
+
+
+        const_iterator(Link *prev, Link *current, ::std::size_t index) noexcept
+            : IteratorBase<const_iterator, const T>(prev, current, index)
+        {
+        }
+
+        explicit operator iterator() const noexcept
+        {
+            return { this->prev, this->current, this->index };
+        }
+    };
+
+    using value_type = T;
+    using allocator_type = TAllocator;
+    using size_type = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = typename ::std::allocator_traits<TAllocator>::pointer;
+    using const_pointer = typename ::std::allocator_traits<TAllocator>::const_pointer;
+
+    static constexpr size_type chunk_capacity = ChunkCapacity;
+
+
+    xor_unrolled_list()
+        : xor_unrolled_list(TAllocator())
+    {}
+
+    explicit xor_unrolled_list(const TAllocator &alloc)
+        : allocator(alloc), beforeHead(&afterTail), afterTail(&beforeHead)
+    {}
+
+    xor_unrolled_list(::std::initializer_list<T> il, const TAllocator &alloc = TAllocator())
+        : xor_unrolled_list(alloc)
+    {
+        assign(::std::move(il));
+    }
+
+    explicit xor_unrolled_list(size_type n, const TAllocator &alloc = TAllocator())
+        : xor_unrolled_list(alloc)
+    {
+        resize(n);
+    }
+
+    xor_unrolled_list(size_type n, const_reference val, const TAllocator &alloc = TAllocator())
+        : xor_unrolled_list(alloc)
+    {
+        resize(n, val);
+    }
+
+    xor_unrolled_list(const xor_unrolled_list &other)
+        : xor_unrolled_list(::std::allocator_traits<ChunkAllocator>::select_on_container_copy_construction(other.allocator))
+    {
+        insert(cbegin(), other.cbegin(), other.cend());
+    }
+
+    xor_unrolled_list(xor_unrolled_list &&other)
+        : allocator(::std::move(other.allocator)), beforeHead(&afterTail), afterTail(&beforeHead)
+    {
+        if (!other.empty())
+        {
+            splice(cbegin(), other);
+        }
+    }
+
+    ~xor_unrolled_list()
+    {
+        clear();
+    }
+
+    xor_unrolled_list& operator=(const xor_unrolled_list &right)
+    {
+        if (this != ::std::addressof(right))
+        {
+            copyAssignmentImpl(right);
+        }
+        return *this;
+    }
+
+    xor_unrolled_list& operator=(xor_unrolled_list &&right)
+    {
+        if (this != ::std::addressof(right))
+        {
+            moveAssignmentImpl(::std::move(right));
+        }
+        return *this;
+    }
+
+    allocator_type get_allocator() const
+    {
+        return allocator_type(allocator);
+    }
+
+    void swap(xor_unrolled_list &other)
+    {
+        swapImpl(other);
+    }
+
+    void push_back(const_reference data)
+    {
+        emplace_back(data);
+    }
+
+    void push_back(T &&data)
+    {
+        emplace_back(::std::move(data));
+    }
+
+    void push_front(const_reference data)
+    {
+        emplace_front(data);
+    }
+
+    void push_front(T &&data)
+    {
+        emplace_front(::std::move(data));
+    }
+
+    template<typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        (void)emplace(cend(), ::std::forward<Args>(args)...);
+    }
+
+    template<typename... Args>
+    void emplace_front(Args&&... args)
+    {
+        (void)emplace(cbegin(), ::std::forward<Args>(args)...);
+    }
+
+    void pop_front()
+    {
+        (void)erase(cbegin());
+    }
+
+    void pop_back()
+    {
+        (void)erase(--cend());
+    }
+
+    size_type size() const noexcept
+    {
+        return length;
+    }
+
+    size_type max_size() const noexcept
+    {
+        return ::std::numeric_limits<size_type>::max() / sizeof(Chunk) * ChunkCapacity;
+    }
+
+    bool empty() const noexcept
+    {
+        return (size() == 0);
+    }
+
+    void clear()
+    {
+        destroyChunks(cutAll());
+        length = 0;
+    }
+
+    T& back()
+    {
+        return *(--end());
+    }
+
+    const T& back() const
+    {
+        return *(--cend());
+    }
+
+    T& front()
+    {
+        return *begin();
+    }
+
+    const T& front() const
+    {
+        return *cbegin();
+    }
+
+    // Iterators and such
+    iterator begin() noexcept
+    {
+        return { &beforeHead, reinterpret_cast<Link*>(beforeHead.xorPtr), 0 };
+    }
+
+    iterator end() noexcept
+    {
+        return { reinterpret_cast<Link*>(afterTail.xorPtr), &afterTail, 0 };
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return { &beforeHead, reinterpret_cast<Link*>(beforeHead.xorPtr), 0 };
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return { reinterpret_cast<Link*>(afterTail.xorPtr), &afterTail, 0 };
+    }
+
+    void sort()
+    {
+        sort(::std::less<T>{});
+    }
+
+    // Every chunk is sorted in place, then chunk sequences are merged bottom-up
+    //  by relocating elements into recycled chunks (at most two extra chunks are allocated).
+    // All iterators will become invalid
+    // Basic exception-safe guarantee (if T's move constructor doesn't throw)
+    template<typename Compare>
+    void sort(Compare isLess)
+    {
+        if (size() < 2)
+        {
+            return;
+        }
+
+        ChunkSequence spare = createSpareChunks();
+        ChunkSequence pending = cutAll();
+        ChunkSequence current;
+        ChunkSequence result;
+
+        ::std::array<ChunkSequence, 64> sortedRanges;
+
+        try
+        {
+            while (pending.first != nullptr)
+            {
+                current = ChunkSequence(popFront(pending));
+                sortChunk(current.first, isLess);
+
+                ::std::size_t i = 0;
+                for ( ; (i < sortedRanges.size() - 1) && (sortedRanges[i].first != nullptr); ++i)
+                {
+                    current = mergeChunkSequences(sortedRanges[i], current, spare, isLess);
+                }
+
+                if (sortedRanges[i].first != nullptr)
+                {
+                    current = mergeChunkSequences(sortedRanges[i], current, spare, isLess);
+                }
+
+                sortedRanges[i] = current;
+                current = ChunkSequence();
+            }
+
+            for (auto &range : sortedRanges)
+            {
+                if (range.first != nullptr)
+                {
+                    result = (result.first == nullptr) ? range
+                                                       : mergeChunkSequences(range, result, spare, isLess);
+                    range = ChunkSequence();
+                }
+            }
+        }
+        catch (...)
+        {
+            append(result, current);
+            append(result, pending);
+            for (auto &range : sortedRanges)
+            {
+                append(result, range);
+            }
+
+            linkSequence(&beforeHead, &afterTail, result);
+            destroyChunks(spare);
+            throw;
+        }
+
+        linkSequence(&beforeHead, &afterTail, result);
+        destroyChunks(spare);
+    }
+
+    // WARNING! Iterators to the elements of the chunk containing position may become invalid
+    // strong exception-safe guarantee
+    iterator insert(const_iterator position, const_reference val)
+    {
+        return emplace(position, val);
+    }
+
+    // WARNING! Iterators to the elements of the chunk containing position may become invalid
+    // strong exception-safe guarantee (if T's move constructor doesn't throw)
+    template<typename InputIterator>
+    iterator insert(const_iterator position, InputIterator first, InputIterator last)
+    {
+        return insertGenerated(position, RangeGenerator<InputIterator>(first, last));
+    }
+
+    // WARNING! Iterators to the elements of the chunk containing position may become invalid
+    // strong exception-safe guarantee (if T's move operations don't throw)
+    template<typename... Args>
+    iterator emplace(const_iterator position, Args&&... args)
+    {
+        if (position.current == &afterTail)
+        {
+            return emplaceBack(::std::forward<Args>(args)...);
+        }
+
+        Chunk *const chunk = asChunk(position.current);
+
+        if ((position.index == 0) && (position.prev != &beforeHead) && (!asChunk(position.prev)->full()))
+        {
+            // Append to the end of the previous chunk instead of shifting this one
+            Chunk *const prevChunk = asChunk(position.prev);
+            constructElement(prevChunk->data() + prevChunk->count, ::std::forward<Args>(args)...);
+            ++prevChunk->count;
+            ++length;
+
+            return { reinterpret_cast<Link*>(xor_list_detail::xorPointers(prevChunk->xorPtr, chunk)), prevChunk,
+                     static_cast<size_type>(prevChunk->count - 1) };
+        }
+
+        if (!chunk->full())
+        {
+            emplaceToChunk(chunk, position.index, ::std::forward<Args>(args)...);
+            ++length;
+
+            return static_cast<iterator>(position);
+        }
+
+        if (position.index == 0)
+        {
+            // New chunk between the previous (full or sentinel) one and this one
+            Chunk *const newChunk = createChunkWithElement(::std::forward<Args>(args)...);
+            linkSequence(position.prev, chunk, ChunkSequence(newChunk));
+            ++length;
+
+            return { position.prev, newChunk, 0 };
+        }
+
+        // args may refer to an element the split moves, so the new element is built first
+        T value(::std::forward<Args>(args)...);
+        const auto splitted = splitChunk(position.prev, chunk, ChunkCapacity / 2);
+
+        if (position.index <= ChunkCapacity / 2)
+        {
+            emplaceToChunk(chunk, position.index, ::std::move(value));
+            ++length;
+
+            return static_cast<iterator>(position);
+        }
+
+        emplaceToChunk(splitted, position.index - ChunkCapacity / 2, ::std::move(value));
+        ++length;
+
+        return { chunk, splitted, position.index - ChunkCapacity / 2 };
+    }
+
+    // WARNING! All iterators will become invalid
+    // Complexity: O(n)
+    void reverse() noexcept
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        Link *const first = reinterpret_cast<Link*>(beforeHead.xorPtr);
+        Link *const last = reinterpret_cast<Link*>(afterTail.xorPtr);
+
+        using xor_list_detail::xorPointers;
+
+        first->xorPtr = xorPointers(xorPointers(first->xorPtr, ::std::addressof(beforeHead)),
+                                    ::std::addressof(afterTail));
+        last->xorPtr = xorPointers(xorPointers(last->xorPtr, ::std::addressof(afterTail)),
+                                   ::std::addressof(beforeHead));
+
+        beforeHead.xorPtr = reinterpret_cast<PtrInteger>(last);
+        afterTail.xorPtr = reinterpret_cast<PtrInteger>(first);
+
+        Link *prev = &beforeHead;
+        for (Link *current = last; current != &afterTail; )
+        {
+            Chunk *const chunk = asChunk(current);
+            ::std::reverse(chunk->data(), chunk->data() + chunk->count);
+
+            current = reinterpret_cast<Link*>(xor_list_detail::xorPointers(prev, current->xorPtr));
+            prev = chunk;
+        }
+    }
+
+    // WARNING! Iterators to the elements of the chunk containing position and of the next chunk may become invalid
+    iterator erase(const_iterator position)
+    {
+        return erase(position, ::std::next(position));
+    }
+
+    // WARNING! Iterators to the elements of the chunks in the range [first, last] and of the chunk after last
+    //  may become invalid
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        if (first == last)
+        {
+            return static_cast<iterator>(last);
+        }
+
+        size_type distance = ::std::distance(first, last);
+
+        Link *prev = first.prev;
+        Link *current = first.current;
+        size_type index = first.index;
+
+        while (distance > 0)
+        {
+            Chunk *const chunk = asChunk(current);
+            Link *const next = reinterpret_cast<Link*>(xor_list_detail::xorPointers(prev, chunk->xorPtr));
+
+            const size_type erased = (::std::min)(distance, static_cast<size_type>(chunk->count - index));
+            eraseFromChunk(chunk, index, erased);
+
+            length -= erased;
+            distance -= erased;
+
+            if (chunk->count == 0)
+            {
+                (void)unlinkSequence(prev, chunk, chunk, next);
+                destroyChunk(chunk);
+
+                current = next;
+                index = 0;
+            }
+            else if (index == chunk->count)
+            {
+                prev = chunk;
+                current = next;
+                index = 0;
+            }
+        }
+
+        // Try to glue the chunk holding the result (or the one before it) with its successor
+        if (index > 0)
+        {
+            (void)mergeWithNext(prev, asChunk(current));
+        }
+        else if ((current != &afterTail) && (prev != &beforeHead))
+        {
+            Chunk *const prevChunk = asChunk(prev);
+            Link *const prevPrev = reinterpret_cast<Link*>(xor_list_detail::xorPointers(prevChunk->xorPtr, current));
+            const size_type prevCount = prevChunk->count;
+
+            if (mergeWithNext(prevPrev, prevChunk))
+            {
+                return { prevPrev, prevChunk, prevCount };
+            }
+        }
+
+        return { prev, current, index };
+    }
+
+    size_type remove(const T &value)
+    {
+        return remove_if([&value](const T &elem) { return (elem == value); });
+    }
+
+    template<typename UnaryPredicate>
+    size_type remove_if(UnaryPredicate p)
+    {
+        const iterator newEnd = ::std::remove_if(begin(), end(), ::std::move(p));
+        const size_type result = ::std::distance(newEnd, end());
+
+        (void)erase(newEnd, end());
+
+        return result;
+    }
+
+    void resize(size_type count)
+    {
+        resizeImpl(count, nullptr);
+    }
+
+    void resize(size_type count, const_reference val)
+    {
+        resizeImpl(count, ::std::addressof(val));
+    }
+
+    template<typename InputIterator>
+    typename ::std::enable_if<::std::is_base_of<::std::input_iterator_tag,
+                                                typename ::std::iterator_traits<InputIterator>::iterator_category>::value>::type
+    assign(InputIterator first, InputIterator last)
+    {
+        for (auto iter = begin(); iter != end(); ++iter, ++first)
+        {
+            if (first == last)
+            {
+                (void)erase(iter, end());
+                return;
+            }
+
+            *iter = *first;
+        }
+
+        (void)insert(cend(), first, last);
+    }
+
+    void assign(size_type count, const_reference val)
+    {
+        auto iter = begin();
+        for ( ; (iter != end()) && (count > 0); ++iter, --count)
+        {
+           *iter = val;
+        }
+
+        if (iter != end())
+        {
+            (void)erase(iter, end());
+        }
+        else if (count > 0)
+        {
+            (void)insertGenerated(cend(), FillGenerator(count, ::std::addressof(val)));
+        }
+    }
+
+    void assign(::std::initializer_list<T> il)
+    {
+        assign(il.begin(), il.end());
+    }
+
+
+    // Chunks of x are relinked, only the chunk containing position may be split
+    // x must use an allocator equal to this one
+    void splice(const_iterator position, xor_unrolled_list &x)
+    {
+        if ((this == ::std::addressof(x)) || (x.empty()))
+        {
+            return;
+        }
+
+        position = splitAt(position);
+
+        const auto distance = x.size();
+        const ChunkSequence sequence = x.cutAll();
+        x.length = 0;
+
+        linkSequence(position.prev, position.current, sequence);
+        length += distance;
+    }
+
+    // The element is moved (not relinked) into this list
+    void splice(const_iterator position, xor_unrolled_list &x, const_iterator i)
+    {
+        if (this != ::std::addressof(x))
+        {
+            (void)emplace(position, ::std::move(*static_cast<iterator>(i)));
+            (void)x.erase(i);
+            return;
+        }
+
+        if ((position == i) || (position == ::std::next(i)))
+        {
+            return;
+        }
+
+        // Inside one list the values are rotated, no chunk is touched
+        if (isBefore(i, position))
+        {
+            (void)::std::rotate(static_cast<iterator>(i), ::std::next(static_cast<iterator>(i)),
+                                static_cast<iterator>(position));
+        }
+        else
+        {
+            (void)::std::rotate(static_cast<iterator>(position), static_cast<iterator>(i),
+                                ::std::next(static_cast<iterator>(i)));
+        }
+    }
+
+    // Whole chunks inside [first, last) are relinked, the boundary chunks are split
+    // x must use an allocator equal to this one
+    void splice(const_iterator position, xor_unrolled_list &x, const_iterator first, const_iterator last)
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        const bool self = (this == ::std::addressof(x));
+
+        splitAt(first, last, position);
+        splitAt(last, first, position);
+        splitAt(position, first, last);
+
+        if ((position == first) || (position == last))
+        {
+            return;
+        }
+
+        Chunk *const firstChunk = asChunk(first.current);
+        Chunk *const lastChunk = asChunk(last.prev);
+
+        size_type distance = 0;
+        if (!self)
+        {
+            Link *prev = first.prev;
+            for (Link *current = firstChunk; current != last.current; )
+            {
+                distance += asChunk(current)->count;
+
+                Link *const next = reinterpret_cast<Link*>(xor_list_detail::xorPointers(prev, current->xorPtr));
+                prev = current;
+                current = next;
+            }
+        }
+
+        const ChunkSequence sequence = unlinkSequence(first.prev, firstChunk, lastChunk, last.current);
+        linkSequence(position.prev, position.current, sequence);
+
+        x.length -= distance;
+        length += distance;
+    }
+
+    // All iterators will become invalid
+    void unique()
+    {
+        unique(::std::equal_to<T>{});
+    }
+
+    // All iterators will become invalid
+    template<typename BinaryPredicate>
+    void unique(BinaryPredicate isEqual)
+    {
+        if (size() < 2)
+        {
+            return;
+        }
+
+        (void)erase(::std::unique(begin(), end(), ::std::move(isEqual)), end());
+    }
+
+    // All iterators from *this and x will become invalid
+    void merge(xor_unrolled_list &x)
+    {
+        merge(x, ::std::less<T>{});
+    }
+
+    // All iterators from *this and x will become invalid
+    // x must use an allocator equal to this one
+    // Basic exception-safe guarantee (if T's move constructor doesn't throw)
+    template<typename Compare>
+    void merge(xor_unrolled_list &x, Compare isLess)
+    {
+        if ((this == ::std::addressof(x)) || (x.empty()))
+        {
+            return;
+        }
+
+        ChunkSequence spare = createSpareChunks();
+        ChunkSequence left = cutAll();
+        ChunkSequence right = x.cutAll();
+
+        try
+        {
+            const ChunkSequence result = (left.first == nullptr) ? right
+                                                                 : mergeChunkSequences(left, right, spare, isLess);
+
+            linkSequence(&beforeHead, &afterTail, result);
+            length += x.length;
+            x.length = 0;
+        }
+        catch (...)
+        {
+            length = countElements(left);
+            x.length = countElements(right);
+
+            if (left.first != nullptr)
+            {
+                linkSequence(&beforeHead, &afterTail, left);
+            }
+            if (right.first != nullptr)
+            {
+                linkSequence(&x.beforeHead, &x.afterTail, right);
+            }
+
+            destroyChunks(spare);
+            throw;
+        }
+
+        destroyChunks(spare);
+    }
+
+private:
+    template<bool c, typename TrueType, typename FalseType>
+    using Cond = xor_list_detail::Cond<c, TrueType, FalseType>;
+    using PtrInteger = xor_list_detail::PtrInteger;
+
+    struct Chunk;
+
+
+    // The smallest integer able to hold ChunkCapacity
+    using ChunkSizeType = Cond<ChunkCapacity <= ::std::numeric_limits<::std::uint8_t>::max(),
+                               ::std::uint8_t,
+                               Cond<ChunkCapacity <= ::std::numeric_limits<::std::uint16_t>::max(),
+                                    ::std::uint16_t,
+                                    Cond<ChunkCapacity <= ::std::numeric_limits<::std::uint32_t>::max(),
+                                         ::std::uint32_t,
+                                         ::std::uint64_t> > >;
+
+
+    // Elements [0, count) of storage are alive
+    struct Chunk : Link
+    {
+        ChunkSizeType count;
+        typename ::std::aligned_storage<sizeof(T), alignof(T)>::type storage[ChunkCapacity];
+
+
+        Chunk()
+            : Link(), count(0)
+        {
+        }
+
+        Chunk(const Chunk&) = delete;
+        Chunk(Chunk &&) = delete;
+
+        ~Chunk() = default;
+
+        Chunk& operator=(const Chunk&) = delete;
+        Chunk& operator=(Chunk &&) = delete;
+
+
+        T* data() noexcept
+        {
+            return reinterpret_cast<T*>(storage);
+        }
+
+        bool full() const noexcept
+        {
+            return (count == ChunkCapacity);
+        }
+    };
+
+
+    #ifdef _MSC_VER
+    using ChunkAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<Chunk>;
+    #else
+    using ChunkAllocator = typename ::std::allocator_traits<TAllocator>::template rebind_alloc<Chunk>;
+    #endif
+
+
+    template<typename It, typename V>
+    class IteratorBase
+    {
+    public:
+        // =========================== Iterator Concept ===============================
+        using difference_type = ::std::ptrdiff_t;
+        using value_type = V;
+        using pointer = value_type*;
+        using reference = value_type&;
+        using iterator_category = ::std::bidirectional_iterator_tag;
+
+
+        reference operator*() const
+        {
+            return asChunk(current)->data()[index];
+        }
+
+        It& operator++()
+        {
+            if (++index == asChunk(current)->count)
+            {
+                Link *next = reinterpret_cast<Link*>(xor_list_detail::xorPointers(prev, current->xorPtr));
+
+                prev = current;
+                current = next;
+                index = 0;
+            }
+
+            return static_cast<It&>(*this);
+        }
+        // ======================== End Iterator Concept ==============================
+
+        // ====================== Input/Forward Iterator Concept ======================
+        bool operator==(const It &right) const noexcept
+        {
+            return ((current == right.current) && (index == right.index));
+        }
+
+        bool operator!=(const It &right) const noexcept
+        {
+            return !(*this == right);
+        }
+
+        pointer operator->() const
+        {
+            return ::std::addressof(asChunk(current)->data()[index]);
+        }
+
+        It operator++(int)
+        {
+            It result(static_cast<It&>(*this));
+            (void)++(*this);
+            return result;
+        }
+        // ==================== End Input/Forward Iterator Concept ====================
+
+        // ===================== Bidirectional Iterator Concept =======================
+        It& operator--()
+        {
+            if (index == 0)
+            {
+                Link *newPrev = reinterpret_cast<Link*>(xor_list_detail::xorPointers(prev->xorPtr, current));
+
+                current = prev;
+                prev = newPrev;
+                index = asChunk(current)->count - 1;
+            }
+            else
+            {
+                --index;
+            }
+
+            return static_cast<It&>(*this);
+        }
+
+        It operator--(int)
+        {
+            It result(static_cast<It&>(*this));
+            (void)--(*this);
+            return result;
+        }
+        // =================== End Bidirectional Iterator Concept =====================
+    protected:
+        Link *prev;
+        Link *current;
+        ::std::size_t index;
+
+
+        IteratorBase(Link *prev = nullptr, Link *current = nullptr, ::std::size_t index = 0) noexcept
+            : prev(prev), current(current), index(index)
+        {
+        }
+
+        IteratorBase(const IteratorBase&) noexcept = default;
+        IteratorBase(IteratorBase&&) noexcept = default;
+
+        ~IteratorBase() noexcept = default;
+
+        IteratorBase& operator=(const IteratorBase&) noexcept = default;
+        IteratorBase& operator=(IteratorBase&&) noexcept = default;
+
+    private:
+        friend class xor_unrolled_list<T, ChunkCapacity, TAllocator>;
+    };
+
+
+    // Detached sequence of chunks, the outer links of both ends are nullptr
+    struct ChunkSequence final
+    {
+        Chunk *first;
+        Chunk *last;
+
+
+        ChunkSequence() noexcept
+            : first(nullptr), last(nullptr)
+        {}
+
+        explicit ChunkSequence(Chunk *single) noexcept
+            : first(single), last(single)
+        {
+            single->xorPtr = 0;
+        }
+
+        ChunkSequence(Chunk *first, Chunk *last) noexcept
+            : first(first), last(last)
+        {}
+    };
+
+
+    // Produces elements of [first, last)
+    template<typename InputIterator>
+    struct RangeGenerator final
+    {
+        InputIterator first;
+        InputIterator last;
+
+
+        RangeGenerator(InputIterator first, InputIterator last)
+            : first(first), last(last)
+        {}
+
+        bool done() const
+        {
+            return (first == last);
+        }
+
+        void construct(xor_unrolled_list &list, T *place)
+        {
+            list.constructElement(place, *first);
+            ++first;
+        }
+    };
+
+    // Produces count copies of *value (or value-initialized elements if value is nullptr)
+    struct FillGenerator final
+    {
+        size_type count;
+        const T *value;
+
+
+        FillGenerator(size_type count, const T *value)
+            : count(count), value(value)
+        {}
+
+        bool done() const
+        {
+            return (count == 0);
+        }
+
+        void construct(xor_unrolled_list &list, T *place)
+        {
+            if (value != nullptr)
+            {
+                list.constructElement(place, *value);
+            }
+            else
+            {
+                list.constructElement(place);
+            }
+
+            --count;
+        }
+    };
+
+
+    ChunkAllocator allocator;
+    mutable Link beforeHead;
+    mutable Link afterTail;
+    size_type length = 0;
+
+
+    static Chunk* asChunk(Link *const link) noexcept
+    {
+        return static_cast<Chunk*>(link);
+    }
+
+
+    template<typename... Args>
+    void constructElement(T *const place, Args&&... args)
+    {
+        ::std::allocator_traits<ChunkAllocator>::construct(allocator, place, ::std::forward<Args>(args)...);
+    }
+
+    void destroyElement(T *const place)
+    {
+        ::std::allocator_traits<ChunkAllocator>::destroy(allocator, place);
+    }
+
+    // Moves count elements from src to the uninitialized dst and destroys the sources
+    // On exception nothing is changed (if T's move constructor doesn't throw, a copy is made otherwise)
+    void relocateElements(T *const src, size_type count, T *const dst)
+    {
+        size_type i = 0;
+
+        try
+        {
+            for ( ; i < count; ++i)
+            {
+                constructElement(dst + i, ::std::move_if_noexcept(src[i]));
+            }
+        }
+        catch (...)
+        {
+            while (i > 0)
+            {
+                destroyElement(dst + --i);
+            }
+            throw;
+        }
+
+        for (i = 0; i < count; ++i)
+        {
+            destroyElement(src + i);
+        }
+    }
+
+
+    Chunk* createChunk()
+    {
+        Chunk *const result = ::std::allocator_traits<ChunkAllocator>::allocate(allocator, 1);
+
+        try
+        {
+            ::std::allocator_traits<ChunkAllocator>::construct(allocator, result);
+        }
+        catch (...)
+        {
+            ::std::allocator_traits<ChunkAllocator>::deallocate(allocator, result, 1);
+            throw;
+        }
+
+        return result;
+    }
+
+    // Returns a chunk with the single element constructed from args
+    template<typename... Args>
+    Chunk* createChunkWithElement(Args&&... args)
+    {
+        Chunk *const result = createChunk();
+
+        try
+        {
+            constructElement(result->data(), ::std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            destroyChunk(result);
+            throw;
+        }
+
+        result->count = 1;
+        return result;
+    }
+
+    void destroyChunk(Chunk *const chunk)
+    {
+        for (ChunkSizeType i = 0; i < chunk->count; ++i)
+        {
+            destroyElement(chunk->data() + i);
+        }
+
+        ::std::allocator_traits<ChunkAllocator>::destroy(allocator, chunk);
+        ::std::allocator_traits<ChunkAllocator>::deallocate(allocator, chunk, 1);
+    }
+
+    void destroyChunks(ChunkSequence sequence)
+    {
+        while (sequence.first != nullptr)
+        {
+            destroyChunk(popFront(sequence));
+        }
+    }
+
+    ChunkSequence createSpareChunks()
+    {
+        ChunkSequence result;
+
+        try
+        {
+            pushBack(result, createChunk());
+            pushBack(result, createChunk());
+        }
+        catch (...)
+        {
+            destroyChunks(result);
+            throw;
+        }
+
+        return result;
+    }
+
+
+    // ============================= Chunk sequences ==============================
+    static void pushBack(ChunkSequence &sequence, Chunk *const chunk) noexcept
+    {
+        chunk->xorPtr = reinterpret_cast<PtrInteger>(static_cast<Link*>(sequence.last));
+
+        if (sequence.last != nullptr)
+        {
+            sequence.last->xorPtr = xor_list_detail::xorPointers(sequence.last->xorPtr, chunk);
+        }
+        else
+        {
+            sequence.first = chunk;
+        }
+
+        sequence.last = chunk;
+    }
+
+    static Chunk* popFront(ChunkSequence &sequence) noexcept
+    {
+        Chunk *const result = sequence.first;
+        Chunk *const next = asChunk(reinterpret_cast<Link*>(result->xorPtr));
+
+        if (next != nullptr)
+        {
+            next->xorPtr = xor_list_detail::xorPointers(next->xorPtr, result);
+        }
+        else
+        {
+            sequence.last = nullptr;
+        }
+
+        sequence.first = next;
+        return result;
+    }
+
+    // Appends from to the end of to, from becomes empty
+    static void append(ChunkSequence &to, ChunkSequence &from) noexcept
+    {
+        if (from.first == nullptr)
+        {
+            return;
+        }
+
+        if (to.first == nullptr)
+        {
+            to = from;
+        }
+        else
+        {
+            to.last->xorPtr = xor_list_detail::xorPointers(to.last->xorPtr, from.first);
+            from.first->xorPtr = xor_list_detail::xorPointers(from.first->xorPtr, to.last);
+            to.last = from.last;
+        }
+
+        from = ChunkSequence();
+    }
+
+    static size_type countElements(ChunkSequence sequence) noexcept
+    {
+        size_type result = 0;
+
+        Link *prev = nullptr;
+        for (Link *current = sequence.first; current != nullptr; )
+        {
+            result += asChunk(current)->count;
+
+            Link *const next = reinterpret_cast<Link*>(xor_list_detail::xorPointers(prev, current->xorPtr));
+            prev = current;
+            current = next;
+        }
+
+        return result;
+    }
+
+    // Links non-empty sequence between adjacent prev and next
+    static void linkSequence(Link *const prev, Link *const next, const ChunkSequence sequence) noexcept
+    {
+        sequence.first->xorPtr = xor_list_detail::xorPointers(sequence.first->xorPtr, prev);
+        sequence.last->xorPtr = xor_list_detail::xorPointers(sequence.last->xorPtr, next);
+
+        prev->xorPtr = xor_list_detail::xorPointers(xor_list_detail::xorPointers(prev->xorPtr, next), sequence.first);
+        next->xorPtr = xor_list_detail::xorPointers(xor_list_detail::xorPointers(next->xorPtr, prev), sequence.last);
+    }
+
+    // Unlinks chunks [first, last] which lie between prev and next
+    static ChunkSequence unlinkSequence(Link *const prev, Chunk *const first, Chunk *const last,
+                                        Link *const next) noexcept
+    {
+        prev->xorPtr = xor_list_detail::xorPointers(xor_list_detail::xorPointers(prev->xorPtr, first), next);
+        next->xorPtr = xor_list_detail::xorPointers(xor_list_detail::xorPointers(next->xorPtr, last), prev);
+
+        first->xorPtr = xor_list_detail::xorPointers(first->xorPtr, prev);
+        last->xorPtr = xor_list_detail::xorPointers(last->xorPtr, next);
+
+        return { first, last };
+    }
+
+    // Moves all chunks of the list into detached sequence (length remains unchanged)
+    ChunkSequence cutAll() noexcept
+    {
+        if (empty())
+        {
+            return {};
+        }
+
+        return unlinkSequence(&beforeHead, asChunk(reinterpret_cast<Link*>(beforeHead.xorPtr)),
+                              asChunk(reinterpret_cast<Link*>(afterTail.xorPtr)), &afterTail);
+    }
+    // =========================== End chunk sequences ============================
+
+
+    // Shifts elements [index, count) of the non-full chunk to the right and constructs new one at index
+    template<typename... Args>
+    void emplaceToChunk(Chunk *const chunk, size_type index, Args&&... args)
+    {
+        T *const data = chunk->data();
+        const size_type count = chunk->count;
+
+        if (index == count)
+        {
+            constructElement(data + count, ::std::forward<Args>(args)...);
+            ++chunk->count;
+            return;
+        }
+
+        T value(::std::forward<Args>(args)...);
+
+        constructElement(data + count, ::std::move(data[count - 1]));
+        ++chunk->count;
+
+        (void)::std::move_backward(data + index, data + count - 1, data + count);
+        data[index] = ::std::move(value);
+    }
+
+    // Removes elements [index, index + count) of the chunk, shifting the rest to the left
+    void eraseFromChunk(Chunk *const chunk, size_type index, size_type count)
+    {
+        T *const data = chunk->data();
+
+        (void)::std::move(data + index + count, data + chunk->count, data + index);
+
+        for (size_type i = chunk->count - count; i < chunk->count; ++i)
+        {
+            destroyElement(data + i);
+        }
+
+        chunk->count -= static_cast<ChunkSizeType>(count);
+    }
+
+    template<typename... Args>
+    iterator emplaceBack(Args&&... args)
+    {
+        Link *const last = reinterpret_cast<Link*>(afterTail.xorPtr);
+
+        if ((last != &beforeHead) && (!asChunk(last)->full()))
+        {
+            Chunk *const lastChunk = asChunk(last);
+            constructElement(lastChunk->data() + lastChunk->count, ::std::forward<Args>(args)...);
+            ++lastChunk->count;
+            ++length;
+
+            return { reinterpret_cast<Link*>(xor_list_detail::xorPointers(lastChunk->xorPtr, &afterTail)), lastChunk,
+                     static_cast<size_type>(lastChunk->count - 1) };
+        }
+
+        Chunk *const newChunk = createChunkWithElement(::std::forward<Args>(args)...);
+        linkSequence(last, &afterTail, ChunkSequence(newChunk));
+        ++length;
+
+        return { last, newChunk, 0 };
+    }
+
+    // Moves elements [index, count) of the chunk into the new chunk linked right after it
+    // Returns the new chunk
+    // On exception nothing is changed
+    Chunk* splitChunk(Link *const prev, Chunk *const chunk, size_type index)
+    {
+        Chunk *const result = createChunk();
+
+        try
+        {
+            relocateElements(chunk->data() + index, chunk->count - index, result->data());
+        }
+        catch (...)
+        {
+            destroyChunk(result);
+            throw;
+        }
+
+        result->count = static_cast<ChunkSizeType>(chunk->count - index);
+        chunk->count = static_cast<ChunkSizeType>(index);
+
+        Link *const next = reinterpret_cast<Link*>(xor_list_detail::xorPointers(prev, chunk->xorPtr));
+        linkSequence(chunk, next, ChunkSequence(result));
+
+        return result;
+    }
+
+    // Splits the chunk containing position so that position points to the beginning of a chunk
+    const_iterator splitAt(const_iterator position)
+    {
+        if (position.index == 0)
+        {
+            return position;
+        }
+
+        Chunk *const chunk = asChunk(position.current);
+        return { chunk, splitChunk(position.prev, chunk, position.index), 0 };
+    }
+
+    // Same as above, but also fixes other1 and other2 if they point into the splitted chunk or the next one
+    void splitAt(const_iterator &position, const_iterator &other1, const_iterator &other2)
+    {
+        if (position.index == 0)
+        {
+            return;
+        }
+
+        Chunk *const chunk = asChunk(position.current);
+        const size_type index = position.index;
+        Chunk *const splitted = splitChunk(position.prev, chunk, index);
+
+        position = { chunk, splitted, 0 };
+
+        fixAfterSplit(other1, chunk, splitted, index);
+        fixAfterSplit(other2, chunk, splitted, index);
+    }
+
+    static void fixAfterSplit(const_iterator &iter, Chunk *const chunk, Chunk *const splitted, size_type index) noexcept
+    {
+        if ((iter.current == chunk) && (iter.index >= index))
+        {
+            iter = { chunk, splitted, iter.index - index };
+        }
+        else if (iter.prev == chunk)
+        {
+            iter.prev = splitted;
+        }
+    }
+
+    // Moves all elements of the chunk following chunk into it if the result is not too dense
+    // Returns true if the chunks were merged
+    bool mergeWithNext(Link *const prev, Chunk *const chunk)
+    {
+        Link *const next = reinterpret_cast<Link*>(xor_list_detail::xorPointers(prev, chunk->xorPtr));
+
+        if (next == &afterTail)
+        {
+            return false;
+        }
+
+        Chunk *const nextChunk = asChunk(next);
+
+        if (chunk->count + nextChunk->count > ChunkCapacity - ChunkCapacity / 4)
+        {
+            return false;
+        }
+
+        relocateElements(nextChunk->data(), nextChunk->count, chunk->data() + chunk->count);
+        chunk->count += nextChunk->count;
+        nextChunk->count = 0;
+
+        Link *const nextNext = reinterpret_cast<Link*>(xor_list_detail::xorPointers(chunk, next->xorPtr));
+        (void)unlinkSequence(chunk, nextChunk, nextChunk, nextNext);
+        destroyChunk(nextChunk);
+
+        return true;
+    }
+
+    // Returns true if first precedes second in the list
+    bool isBefore(const_iterator first, const_iterator second) const
+    {
+        for (auto iter = cbegin(); iter != cend(); ++iter)
+        {
+            if (iter == second)
+            {
+                return false;
+            }
+            if (iter == first)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+
+    // Constructs generated elements before position:
+    //  at first into the free space of the chunk before position, then into the new chunks
+    template<typename Generator>
+    iterator insertGenerated(const_iterator position, Generator generator)
+    {
+        if (generator.done())
+        {
+            return static_cast<iterator>(position);
+        }
+
+        position = splitAt(position);
+
+        Chunk *const prevChunk = (position.prev != &beforeHead) ? asChunk(position.prev) : nullptr;
+        const ChunkSizeType prevCount = (prevChunk != nullptr) ? prevChunk->count : 0;
+
+        ChunkSequence sequence;
+        size_type inserted = 0;
+
+        try
+        {
+            if (prevChunk != nullptr)
+            {
+                for ( ; (!prevChunk->full()) && (!generator.done()); ++prevChunk->count, ++inserted)
+                {
+                    generator.construct(*this, prevChunk->data() + prevChunk->count);
+                }
+            }
+
+            while (!generator.done())
+            {
+                Chunk *const chunk = createChunk();
+                pushBack(sequence, chunk);
+
+                for ( ; (!chunk->full()) && (!generator.done()); ++chunk->count, ++inserted)
+                {
+                    generator.construct(*this, chunk->data() + chunk->count);
+                }
+            }
+        }
+        catch (...)
+        {
+            destroyChunks(sequence);
+
+            if (prevChunk != nullptr)
+            {
+                for (ChunkSizeType i = prevCount; i < prevChunk->count; ++i)
+                {
+                    destroyElement(prevChunk->data() + i);
+                }
+                prevChunk->count = prevCount;
+            }
+
+            throw;
+        }
+
+        length += inserted;
+
+        Link *const prevPrev = (prevChunk != nullptr)
+                               ? reinterpret_cast<Link*>(xor_list_detail::xorPointers(prevChunk->xorPtr, position.current))
+                               : nullptr;
+
+        if (sequence.first != nullptr)
+        {
+            linkSequence(position.prev, position.current, sequence);
+        }
+
+        if ((prevChunk != nullptr) && (prevChunk->count > prevCount))
+        {
+            return { prevPrev, prevChunk, prevCount };
+        }
+
+        return { position.prev, sequence.first, 0 };
+    }
+
+    void resizeImpl(size_type count, const T *value)
+    {
+        if (count < size())
+        {
+            const_iterator newEnd = (count < size() / 2) ? ::std::next(cbegin(), count)
+                                                         : ::std::prev(cend(), size() - count);
+            (void)erase(newEnd, cend());
+        }
+        else if (count > size())
+        {
+            (void)insertGenerated(cend(), FillGenerator(count - size(), value));
+        }
+    }
+
+
+    // Binary insertion sort of the chunk elements
+    template<typename Compare>
+    static void sortChunk(Chunk *const chunk, Compare &isLess)
+    {
+        T *const data = chunk->data();
+
+        for (size_type i = 1; i < chunk->count; ++i)
+        {
+            if (!isLess(data[i], data[i - 1]))
+            {
+                continue;
+            }
+
+            // The comparator is not invoked after the element is moved out
+            T *const position = ::std::upper_bound(data, data + i, data[i], isLess);
+            T value(::std::move(data[i]));
+
+            (void)::std::move_backward(position, data + i, data + i + 1);
+            *position = ::std::move(value);
+        }
+    }
+
+    Chunk* takeSpareChunk(ChunkSequence &spare)
+    {
+        return (spare.first != nullptr) ? popFront(spare) : createChunk();
+    }
+
+    // Moves the alive elements [index, count) of the chunk to its beginning
+    void normalizeChunk(Chunk *const chunk, size_type index)
+    {
+        if (index == 0)
+        {
+            return;
+        }
+
+        T *const data = chunk->data();
+        const size_type count = chunk->count - index;
+
+        for (size_type i = 0; i < count; ++i)
+        {
+            constructElement(data + i, ::std::move(data[index + i]));
+            destroyElement(data + index + i);
+        }
+
+        chunk->count = static_cast<ChunkSizeType>(count);
+    }
+
+    // Merges sorted sequences left and right (stable, left elements go first among equivalent ones)
+    //  by relocating elements into the chunks from spare (drained chunks are returned to spare)
+    // On success returns the result and both left and right become empty
+    // On exception left contains all already merged elements followed by its rest, right contains its rest
+    template<typename Compare>
+    ChunkSequence mergeChunkSequences(ChunkSequence &left, ChunkSequence &right, ChunkSequence &spare,
+                                      Compare &isLess)
+    {
+        ChunkSequence result;
+        Chunk *out = nullptr;
+        size_type leftIndex = 0;
+        size_type rightIndex = 0;
+
+        // Moves the next element of from into out
+        auto relocateNext = [&](ChunkSequence &from, size_type &fromIndex)
+        {
+            if ((out == nullptr) || (out->full()))
+            {
+                out = takeSpareChunk(spare);
+                pushBack(result, out);
+            }
+
+            T *const source = from.first->data() + fromIndex;
+
+            constructElement(out->data() + out->count, ::std::move(*source));
+            ++out->count;
+            destroyElement(source);
+
+            if (++fromIndex == from.first->count)
+            {
+                Chunk *const drained = popFront(from);
+                drained->count = 0;
+                pushBack(spare, drained);
+                fromIndex = 0;
+            }
+        };
+
+        try
+        {
+            while ((left.first != nullptr) && (right.first != nullptr))
+            {
+                if (isLess(right.first->data()[rightIndex], left.first->data()[leftIndex]))
+                {
+                    relocateNext(right, rightIndex);
+                }
+                else
+                {
+                    relocateNext(left, leftIndex);
+                }
+            }
+
+            ChunkSequence &rest = (left.first != nullptr) ? left : right;
+            size_type &restIndex = (left.first != nullptr) ? leftIndex : rightIndex;
+
+            // Fill the free space of the last result chunk, then relink the rest as is
+            while ((rest.first != nullptr) && ((restIndex > 0) || ((out != nullptr) && (!out->full()))))
+            {
+                if ((out != nullptr) && (!out->full()))
+                {
+                    relocateNext(rest, restIndex);
+                }
+                else
+                {
+                    normalizeChunk(rest.first, restIndex);
+                    restIndex = 0;
+                }
+            }
+
+            append(result, rest);
+        }
+        catch (...)
+        {
+            if (left.first != nullptr)
+            {
+                normalizeChunk(left.first, leftIndex);
+            }
+            if (right.first != nullptr)
+            {
+                normalizeChunk(right.first, rightIndex);
+            }
+
+            append(result, left);
+            left = result;
+            throw;
+        }
+
+        return result;
+    }
+
+
+    void swapWithoutAllocators(xor_unrolled_list &other)
+    {
+        const ChunkSequence thisSequence = cutAll();
+        const ChunkSequence otherSequence = other.cutAll();
+
+        if (otherSequence.first != nullptr)
+        {
+            linkSequence(&beforeHead, &afterTail, otherSequence);
+        }
+        if (thisSequence.first != nullptr)
+        {
+            other.linkSequence(&other.beforeHead, &other.afterTail, thisSequence);
+        }
+
+        ::std::swap(length, other.length);
+    }
+
+    template<typename Alloc = ChunkAllocator>
+    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_swap::value>::type
+    swapImpl(xor_unrolled_list &other)
+    {
+        ::std::swap(allocator, other.allocator);
+        swapWithoutAllocators(other);
+    }
+
+    template<typename Alloc = ChunkAllocator>
+    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_swap::value>::type
+    swapImpl(xor_unrolled_list &other)
+    {
+        swapWithoutAllocators(other);
+    }
+
+
+    template<typename Alloc = ChunkAllocator>
+    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value>::type
+    copyAssignmentImpl(const xor_unrolled_list &right)
+    {
+        clear();
+        allocator = right.allocator;
+        assign(right.cbegin(), right.cend());
+    }
+
+    template<typename Alloc = ChunkAllocator>
+    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_copy_assignment::value>::type
+    copyAssignmentImpl(const xor_unrolled_list &right)
+    {
+        clear();
+        assign(right.cbegin(), right.cend());
+    }
+
+
+    template<typename Alloc = ChunkAllocator>
+    typename ::std::enable_if<::std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value>::type
+    moveAssignmentImpl(xor_unrolled_list &&right)
+    {
+        clear();
+        allocator = ::std::move(right.allocator);
+        splice(cbegin(), right);
+    }
+
+    template<typename Alloc = ChunkAllocator>
+    typename ::std::enable_if<!::std::allocator_traits<Alloc>::propagate_on_container_move_assignment::value>::type
+    moveAssignmentImpl(xor_unrolled_list &&right)
+    {
+        clear();
+
+        if (allocator == right.allocator)
+        {
+            splice(cbegin(), right);
+        }
+        else
+        {
+            for (T &moved : right)
+            {
+                emplace_back(::std::move(moved));
+            }
+
+            right.clear();
+        }
+    }
+};
+
+template<typename T, ::std::size_t ChunkCapacity, class TAllocator>
+constexpr typename xor_unrolled_list<T, ChunkCapacity, TAllocator>::size_type
+xor_unrolled_list<T, ChunkCapacity, TAllocator>::chunk_capacity;
+
+
+// Comparison operators
+
+template<typename T, ::std::size_t ChunkCapacity, class TAllocator>
+bool operator==(const xor_unrolled_list<T, ChunkCapacity, TAllocator> &lhs,
+                const xor_unrolled_list<T, ChunkCapacity, TAllocator> &rhs)
+{
+    return ((lhs.size() == rhs.size()) && (::std::equal(lhs.cbegin(), lhs.cend(), rhs.cbegin())));
+}
+
+template<typename T, ::std::size_t ChunkCapacity, class TAllocator>
+bool operator!=(const xor_unrolled_list<T, ChunkCapacity, TAllocator> &lhs,
+                const xor_unrolled_list<T, ChunkCapacity, TAllocator> &rhs)
+{
+    return (!(lhs == rhs));
+}
+
+template<typename T, ::std::size_t ChunkCapacity, class TAllocator>
+bool operator<(const xor_unrolled_list<T, ChunkCapacity, TAllocator> &lhs,
+               const xor_unrolled_list<T, ChunkCapacity, TAllocator> &rhs)
+{
+    return ::std::lexicographical_compare(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend());
+}
+
+template<typename T, ::std::size_t ChunkCapacity, class TAllocator>
+bool operator>(const xor_unrolled_list<T, ChunkCapacity, TAllocator> &lhs,
+               const xor_unrolled_list<T, ChunkCapacity, TAllocator> &rhs)
+{
+    return (rhs < lhs);
+}
+
+template<typename T, ::std::size_t ChunkCapacity, class TAllocator>
+bool operator<=(const xor_unrolled_list<T, ChunkCapacity, TAllocator> &lhs,
+                const xor_unrolled_list<T, ChunkCapacity, TAllocator> &rhs)
+{
+    return (!(rhs < lhs));
+}
+
+template<typename T, ::std::size_t ChunkCapacity, class TAllocator>
+bool operator>=(const xor_unrolled_list<T, ChunkCapacity, TAllocator> &lhs,
+                const xor_unrolled_list<T, ChunkCapacity, TAllocator> &rhs)
+{
+    return (!(lhs < rhs));
+}
+
+#endif //XORLIST_XOR_UNROLLED_LIST_H
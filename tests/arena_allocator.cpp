@@ -0,0 +1,205 @@
+#include <xor_list/xor_arena_allocator.h>
+#include <xor_list/xor_list.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <string>
+#include <utility>
+#include <memory>
+#include <cstdint>
+#include <iterator>
+
+
+template<typename T>
+using arena_list = xor_list<T, xor_arena_allocator<T, 256>>;
+
+
+struct DestructionCounter
+{
+    int *counter;
+    int value;
+
+
+    DestructionCounter(int *counter, int value)
+        : counter(counter), value(value)
+    {
+    }
+
+    ~DestructionCounter()
+    {
+        ++*counter;
+    }
+};
+
+
+TEST(ARENA_ALLOCATOR, ALLOCATIONS_ARE_ALIGNED_AND_DISTINCT)
+{
+    xor_arena_allocator<char, 256> allocator;
+    xor_arena_allocator<long double, 256> rebound(allocator);
+
+    char *const c = allocator.allocate(1);
+    long double *const ld = rebound.allocate(1);
+    char *const big = allocator.allocate(1000);
+
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(ld) % alignof(long double), 0U);
+    ASSERT_NE(static_cast<void*>(c), static_cast<void*>(ld));
+    ASSERT_NE(big, c);
+    ASSERT_TRUE(allocator == rebound);
+}
+
+TEST(ARENA_ALLOCATOR, RESET_ONLY_WHEN_SOLE_OWNER)
+{
+    xor_arena_allocator<int, 256> allocator;
+    int *const first = allocator.allocate(1);
+
+    {
+        xor_arena_allocator<int, 256> copy(allocator);
+        ASSERT_FALSE(allocator.reset());
+    }
+
+    ASSERT_TRUE(allocator.reset());
+    ASSERT_EQ(allocator.allocate(1), first);
+}
+
+TEST(ARENA_ALLOCATOR, CLEAR_REWINDS_ARENA)
+{
+    arena_list<int> list;
+
+    for (int i = 0; i < 200; ++i)
+    {
+        list.push_back(i);
+    }
+
+    const int *const front = std::addressof(list.front());
+
+    list.clear();
+
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.begin(), list.end());
+
+    list.push_back(10);
+    list.push_front(5);
+
+    ASSERT_EQ(std::addressof(list.back()), front);
+    ASSERT_THAT(list, ::testing::ElementsAre(5, 10));
+}
+
+TEST(ARENA_ALLOCATOR, CLEAR_RUNS_DESTRUCTORS)
+{
+    int destroyed = 0;
+
+    {
+        arena_list<DestructionCounter> list;
+
+        for (int i = 0; i < 50; ++i)
+        {
+            list.emplace_back(&destroyed, i);
+        }
+
+        (void)list.erase(list.cbegin());
+        ASSERT_EQ(destroyed, 1);
+
+        list.clear();
+        ASSERT_EQ(destroyed, 50);
+
+        list.emplace_back(&destroyed, 0);
+    }
+
+    ASSERT_EQ(destroyed, 51);
+}
+
+TEST(ARENA_ALLOCATOR, SHARED_ARENA_IS_NOT_RESET)
+{
+    xor_arena_allocator<std::string, 256> allocator;
+    arena_list<std::string> l1(allocator), l2(allocator);
+
+    l1.assign({"1", "2", "3"});
+    l2.assign({"4", "5", "6"});
+
+    l1.clear();
+    l1.push_back("7");
+
+    ASSERT_THAT(l1, ::testing::ElementsAre("7"));
+    ASSERT_THAT(l2, ::testing::ElementsAre("4", "5", "6"));
+}
+
+TEST(ARENA_ALLOCATOR, COPY_GETS_OWN_ARENA)
+{
+    arena_list<int> l1{1, 2, 3};
+    arena_list<int> l2(l1);
+
+    ASSERT_TRUE(l1.get_allocator() != l2.get_allocator());
+
+    l1.clear();
+    l1.assign({7, 8, 9, 10});
+
+    ASSERT_THAT(l2, ::testing::ElementsAre(1, 2, 3));
+}
+
+TEST(ARENA_ALLOCATOR, MOVE_AND_SWAP)
+{
+    arena_list<std::string> l1{"a", "b"}, l2{"c"};
+
+    l1.swap(l2);
+    ASSERT_THAT(l1, ::testing::ElementsAre("c"));
+    ASSERT_THAT(l2, ::testing::ElementsAre("a", "b"));
+
+    arena_list<std::string> l3(std::move(l2));
+    ASSERT_TRUE(l2.empty());
+    ASSERT_THAT(l3, ::testing::ElementsAre("a", "b"));
+
+    l3 = std::move(l1);
+    ASSERT_THAT(l3, ::testing::ElementsAre("c"));
+}
+
+TEST(ARENA_ALLOCATOR, RANGE_INSERT_ALLOCATES_ONE_BLOCK)
+{
+    const int range[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    arena_list<int> list{100};
+
+    (void)list.insert(list.cend(), std::begin(range), std::end(range));
+
+    ASSERT_THAT(list, ::testing::ElementsAre(100, 1, 2, 3, 4, 5, 6, 7, 8));
+
+    const auto first = reinterpret_cast<const char*>(std::addressof(*std::next(list.cbegin())));
+    const auto second = reinterpret_cast<const char*>(std::addressof(*std::next(list.cbegin(), 2)));
+    auto expected = second;
+
+    for (auto iter = std::next(list.cbegin(), 2); iter != list.cend(); ++iter)
+    {
+        ASSERT_EQ(reinterpret_cast<const char*>(std::addressof(*iter)), expected);
+        expected += second - first;
+    }
+}
+
+TEST(ARENA_ALLOCATOR, LIST_COMPACT)
+{
+    int destructed = 0;
+
+    {
+        arena_list<DestructionCounter> list;
+
+        for (int i = 0; i < 5; ++i)
+        {
+            list.emplace_front(&destructed, i);
+        }
+
+        list.compact();
+        ASSERT_EQ(destructed, 5);
+
+        int expected = 4;
+        for (const auto &value : list)
+        {
+            ASSERT_EQ(value.value, expected--);
+        }
+
+        // The nodes come from one allocation in list order
+        const auto first = reinterpret_cast<std::uintptr_t>(std::addressof(*list.cbegin()));
+        const auto second = reinterpret_cast<std::uintptr_t>(std::addressof(*std::next(list.cbegin())));
+        const auto third = reinterpret_cast<std::uintptr_t>(std::addressof(*std::next(list.cbegin(), 2)));
+
+        ASSERT_GT(second, first);
+        ASSERT_EQ(third - second, second - first);
+    }
+
+    ASSERT_EQ(destructed, 10);
+}
@@ -0,0 +1,314 @@
+#include <xor_list/xor_intrusive_list.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <vector>
+#include <string>
+#include <iterator>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <stdexcept>
+
+
+struct Item
+{
+    int value;
+    std::string tag;
+    xor_list_hook hook;
+    xor_list_hook otherHook;
+
+
+    Item(int value = 0, std::string tag = "")
+        : value(value), tag(std::move(tag))
+    {
+    }
+
+    bool operator<(const Item &right) const
+    {
+        return (value < right.value);
+    }
+
+    bool operator==(const Item &right) const
+    {
+        return (value == right.value);
+    }
+};
+
+using ItemList = xor_intrusive_list<Item, &Item::hook>;
+using OtherItemList = xor_intrusive_list<Item, &Item::otherHook>;
+
+
+std::vector<int> values(const ItemList &list)
+{
+    std::vector<int> result;
+    for (const Item &item : list)
+    {
+        result.push_back(item.value);
+    }
+    return result;
+}
+
+
+TEST(INTRUSIVE_LIST, CONSTRUCTOR_DEFAULT)
+{
+    ItemList list;
+
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.begin(), list.end());
+}
+
+TEST(INTRUSIVE_LIST, PUSH_POP)
+{
+    std::vector<Item> items{1, 2, 3, 4};
+    ItemList list;
+
+    list.push_back(items[1]);
+    list.push_back(items[2]);
+    list.push_front(items[0]);
+    list.push_back(items[3]);
+
+    ASSERT_EQ(list.size(), 4U);
+    ASSERT_THAT(values(list), ::testing::ElementsAre(1, 2, 3, 4));
+    ASSERT_EQ(std::addressof(list.front()), std::addressof(items[0]));
+    ASSERT_EQ(std::addressof(list.back()), std::addressof(items[3]));
+
+    list.pop_front();
+    list.pop_back();
+
+    ASSERT_FALSE(items[0].hook.is_linked());
+    ASSERT_FALSE(items[3].hook.is_linked());
+    ASSERT_TRUE(items[1].hook.is_linked());
+    ASSERT_THAT(values(list), ::testing::ElementsAre(2, 3));
+}
+
+TEST(INTRUSIVE_LIST, TWO_HOOKS)
+{
+    std::vector<Item> items{1, 2, 3};
+    ItemList list;
+    OtherItemList other;
+
+    for (Item &item : items)
+    {
+        list.push_back(item);
+        other.push_front(item);
+    }
+
+    ASSERT_EQ(other.front().value, 3);
+    ASSERT_EQ(std::next(other.begin())->value, 2);
+    ASSERT_THAT(values(list), ::testing::ElementsAre(1, 2, 3));
+}
+
+TEST(INTRUSIVE_LIST, ITERATOR_DECR)
+{
+    std::vector<Item> items{1, 2, 3};
+    ItemList list;
+    list.insert(list.cend(), items.begin(), items.end());
+
+    auto iter = list.end();
+
+    ASSERT_EQ((--iter)->value, 3);
+    ASSERT_EQ((--iter)->value, 2);
+    ASSERT_EQ((--iter)->value, 1);
+    ASSERT_EQ(iter, list.begin());
+}
+
+TEST(INTRUSIVE_LIST, INSERT_ERASE)
+{
+    std::vector<Item> items{1, 2, 3, 4, 5};
+    ItemList list;
+
+    list.push_back(items[0]);
+    list.push_back(items[4]);
+    (void)list.insert(std::next(list.cbegin()), items.begin() + 1, items.begin() + 4);
+
+    ASSERT_THAT(values(list), ::testing::ElementsAre(1, 2, 3, 4, 5));
+
+    auto iter = list.erase(std::next(list.cbegin()), std::next(list.cbegin(), 3));
+
+    ASSERT_EQ(iter->value, 4);
+    ASSERT_FALSE(items[1].hook.is_linked());
+    ASSERT_FALSE(items[2].hook.is_linked());
+    ASSERT_THAT(values(list), ::testing::ElementsAre(1, 4, 5));
+
+    // Erased objects can be linked again
+    list.push_front(items[2]);
+    ASSERT_THAT(values(list), ::testing::ElementsAre(3, 1, 4, 5));
+}
+
+TEST(INTRUSIVE_LIST, CLEAR_UNLINKS)
+{
+    std::vector<Item> items{1, 2, 3};
+    {
+        ItemList list;
+        list.insert(list.cend(), items.begin(), items.end());
+    }
+
+    for (const Item &item : items)
+    {
+        ASSERT_FALSE(item.hook.is_linked());
+    }
+}
+
+TEST(INTRUSIVE_LIST, COPY_OF_HOOK_IS_UNLINKED)
+{
+    Item item(1);
+    ItemList list;
+    list.push_back(item);
+
+    Item copy(item);
+
+    ASSERT_TRUE(item.hook.is_linked());
+    ASSERT_FALSE(copy.hook.is_linked());
+}
+
+TEST(INTRUSIVE_LIST, REVERSE)
+{
+    std::vector<Item> items{1, 2, 3, 4};
+    ItemList list;
+    list.insert(list.cend(), items.begin(), items.end());
+
+    list.reverse();
+
+    ASSERT_THAT(values(list), ::testing::ElementsAre(4, 3, 2, 1));
+}
+
+TEST(INTRUSIVE_LIST, REVERSE_RANGE_AND_ROTATE)
+{
+    std::vector<Item> items{1, 2, 3, 4, 5, 6};
+    ItemList list;
+    list.insert(list.cend(), items.begin(), items.end());
+
+    list.reverse(std::next(list.cbegin()), std::prev(list.cend()));
+    ASSERT_THAT(values(list), ::testing::ElementsAre(1, 5, 4, 3, 2, 6));
+
+    auto oldFirst = list.rotate(std::next(list.cbegin(), 4));
+    ASSERT_EQ(oldFirst->value, 1);
+    ASSERT_THAT(values(list), ::testing::ElementsAre(2, 6, 1, 5, 4, 3));
+}
+
+TEST(INTRUSIVE_LIST, SPLICE)
+{
+    std::vector<Item> items{1, 2, 3, 4, 5, 6};
+    ItemList l1, l2;
+    l1.insert(l1.cend(), items.begin(), items.begin() + 3);
+    l2.insert(l2.cend(), items.begin() + 3, items.end());
+
+    l1.splice(std::next(l1.cbegin()), l2, std::next(l2.cbegin()));
+    ASSERT_THAT(values(l1), ::testing::ElementsAre(1, 5, 2, 3));
+    ASSERT_THAT(values(l2), ::testing::ElementsAre(4, 6));
+
+    l1.splice(l1.cend(), l1, l1.cbegin(), std::next(l1.cbegin(), 2));
+    ASSERT_THAT(values(l1), ::testing::ElementsAre(2, 3, 1, 5));
+
+    l2.splice(l2.cbegin(), l1);
+    ASSERT_TRUE(l1.empty());
+    ASSERT_EQ(l2.size(), 6U);
+    ASSERT_THAT(values(l2), ::testing::ElementsAre(2, 3, 1, 5, 4, 6));
+}
+
+TEST(INTRUSIVE_LIST, SORT_STABLE)
+{
+    std::vector<Item> items;
+    for (int i = 0; i < 30; ++i)
+    {
+        items.emplace_back((i * 7) % 4, std::to_string(i));
+    }
+
+    ItemList list;
+    list.insert(list.cend(), items.begin(), items.end());
+
+    list.sort();
+
+    ASSERT_EQ(list.size(), items.size());
+    ASSERT_TRUE(std::is_sorted(list.cbegin(), list.cend()));
+
+    auto prev = list.cbegin();
+    for (auto iter = std::next(prev); iter != list.cend(); prev = iter++)
+    {
+        if (prev->value == iter->value)
+        {
+            ASSERT_LT(std::stoi(prev->tag), std::stoi(iter->tag));
+        }
+    }
+}
+
+TEST(INTRUSIVE_LIST, SORT_THROWING_COMPARE)
+{
+    for (const int throwAt : {1, 10, 100, 400, 700})
+    {
+        std::vector<Item> items;
+        for (int i = 0; i < 100; ++i)
+        {
+            items.emplace_back((i * 37) % 100);
+        }
+
+        ItemList list;
+        list.insert(list.cend(), items.begin(), items.end());
+
+        int comparisons = 0;
+        ASSERT_THROW(list.sort([&comparisons, throwAt](const Item &left, const Item &right)
+                               {
+                                   if (++comparisons == throwAt)
+                                   {
+                                       throw std::runtime_error("compare");
+                                   }
+                                   return (left < right);
+                               }), std::runtime_error);
+
+        // Every object is still linked once, in some order
+        std::vector<int> elements = values(list);
+        std::sort(elements.begin(), elements.end());
+
+        ASSERT_EQ(list.size(), 100U);
+        ASSERT_EQ(elements.size(), 100U);
+        for (int i = 0; i < 100; ++i)
+        {
+            ASSERT_EQ(elements[i], i);
+        }
+        ASSERT_EQ(std::distance(std::reverse_iterator<ItemList::const_iterator>(list.cend()),
+                                std::reverse_iterator<ItemList::const_iterator>(list.cbegin())), 100);
+        ASSERT_TRUE(std::all_of(items.cbegin(), items.cend(), [](const Item &item) { return item.hook.is_linked(); }));
+    }
+}
+
+TEST(INTRUSIVE_LIST, MERGE)
+{
+    std::vector<Item> items{1, 3, 5, 0, 2, 4, 6};
+    ItemList l1, l2;
+    l1.insert(l1.cend(), items.begin(), items.begin() + 3);
+    l2.insert(l2.cend(), items.begin() + 3, items.end());
+
+    l1.merge(l2);
+
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), 7U);
+    ASSERT_THAT(values(l1), ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6));
+}
+
+TEST(INTRUSIVE_LIST, MOVE_AND_SWAP)
+{
+    std::vector<Item> items{1, 2, 3};
+    ItemList l1;
+    l1.insert(l1.cend(), items.begin(), items.end());
+
+    ItemList l2(std::move(l1));
+    ASSERT_TRUE(l1.empty());
+    ASSERT_THAT(values(l2), ::testing::ElementsAre(1, 2, 3));
+
+    l1.swap(l2);
+    ASSERT_TRUE(l2.empty());
+    ASSERT_THAT(values(l1), ::testing::ElementsAre(1, 2, 3));
+}
+
+TEST(INTRUSIVE_LIST, REMOVE_IF_UNIQUE)
+{
+    std::vector<Item> items{1, 1, 2, 3, 3, 3, 4};
+    ItemList list;
+    list.insert(list.cend(), items.begin(), items.end());
+
+    list.unique();
+    ASSERT_THAT(values(list), ::testing::ElementsAre(1, 2, 3, 4));
+
+    ASSERT_EQ(list.remove_if([](const Item &item) { return (item.value % 2 == 0); }), 2U);
+    ASSERT_THAT(values(list), ::testing::ElementsAre(1, 3));
+}
@@ -6,6 +6,12 @@
 #include <stdexcept>
 #include <utility>
 #include <iterator>
+#include <sstream>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <functional>
 
 
 template<typename T>
@@ -173,6 +179,54 @@ public:
 
 
 
+struct AllocationCounter
+{
+    static int allocations;
+    static int deallocations;
+
+
+    static void reset() noexcept
+    {
+        allocations = deallocations = 0;
+    }
+};
+
+int AllocationCounter::allocations = 0;
+int AllocationCounter::deallocations = 0;
+
+template<typename T>
+struct CountingAllocator : std::allocator<T>
+{
+public:
+    template<typename R>
+    struct rebind
+    {
+        using other = CountingAllocator<R>;
+    };
+
+
+    CountingAllocator() = default;
+
+    template<typename R>
+    CountingAllocator(const CountingAllocator<R> &) noexcept
+    {
+    }
+
+
+    T* allocate(std::size_t n)
+    {
+        ++AllocationCounter::allocations;
+        return std::allocator<T>::allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n)
+    {
+        ++AllocationCounter::deallocations;
+        std::allocator<T>::deallocate(p, n);
+    }
+};
+
+
 TEST(LIST, CONSTRUCTOR_DEFAULT)
 {
     xor_list<NonMovableValue<int>> list;
@@ -255,12 +309,14 @@ TEST(LIST, COPY_CONSTRUCTOR_EMPTY)
 
 TEST(LIST, COPY_CONSTRUCTOR_NON_EMPTY)
 {
-    xor_list<Value<int>> l1{1, 2, 3, 4, 5, 6, 7, 8, 9}, l2(l1);
+    std::unique_ptr<xor_list<Value<int>>> l1(new xor_list<Value<int>>{1, 2, 3, 4, 5, 6, 7, 8, 9});
+    xor_list<Value<int>> l2(*l1);
 
     ASSERT_EQ(l2.size(), 9U);
     ASSERT_THAT(l2, ::testing::ElementsAre(1, 2, 3, 4, 5, 6, 7, 8, 9));
 
-    l1.~xor_list();
+    // The copy doesn't share nodes with the source
+    l1.reset();
 
     ASSERT_EQ(l2.size(), 9U);
     ASSERT_THAT(l2, ::testing::ElementsAre(1, 2, 3, 4, 5, 6, 7, 8, 9));
@@ -653,6 +709,258 @@ TEST(LIST, MERGE_GENERIC2)
     ASSERT_THAT(l2, ::testing::ElementsAre(0, 1, 2, 2, 3, 4, 4, 8));
 }
 
+TEST(LIST, MERGE_GALLOP_CLUSTERED)
+{
+    using Pair = std::pair<int, int>;
+    const auto isLess = [](const Pair &left, const Pair &right)
+    {
+        return (left.first < right.first);
+    };
+
+    // Long runs on both sides with equal keys at the run bounds
+    std::vector<Pair> to, from;
+    for (int i = 0; i < 1000; ++i)
+    {
+        to.emplace_back((i / 100) * 200 + (i % 100), i);
+        from.emplace_back((i / 100) * 200 + 99 + (i % 100), 1000 + i);
+    }
+
+    xor_list<Pair> l1, l2;
+    l1.assign(to.cbegin(), to.cend());
+    l2.assign(from.cbegin(), from.cend());
+
+    l1.merge(l2, isLess);
+
+    std::vector<Pair> expected;
+    std::merge(to.cbegin(), to.cend(), from.cbegin(), from.cend(), std::back_inserter(expected), isLess);
+
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), expected.size());
+    ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), l1.cbegin()));
+    ASSERT_TRUE(std::equal(expected.crbegin(), expected.crend(),
+                           std::reverse_iterator<xor_list<Pair>::const_iterator>(l1.cend())));
+}
+
+TEST(LIST, MERGE_GALLOP_SKEWED)
+{
+    xor_list<int> big, small{-1, 500, 500, 2000};
+    for (int i = 0; i < 1000; ++i)
+    {
+        big.push_back(i);
+    }
+
+    small.merge(big);
+
+    ASSERT_TRUE(big.empty());
+    ASSERT_EQ(small.size(), 1004U);
+    ASSERT_EQ(small.front(), -1);
+    ASSERT_EQ(small.back(), 2000);
+    ASSERT_TRUE(std::is_sorted(small.cbegin(), small.cend()));
+    ASSERT_EQ(std::count(small.cbegin(), small.cend(), 500), 3);
+}
+TEST(LIST, MERGE_ALL_EMPTY)
+{
+    xor_list<Value<int>> list;
+    std::vector<xor_list<Value<int>>> lists(3);
+
+    list.merge_all(lists.begin(), lists.end());
+
+    ASSERT_TRUE(list.empty());
+    ASSERT_THAT(list, ::testing::ElementsAre());
+}
+
+TEST(LIST, MERGE_ALL_GENERIC)
+{
+    xor_list<Value<int>> list{2, 7};
+    std::vector<xor_list<Value<int>>> lists(4);
+    lists[0] = {1, 4, 9};
+    lists[2] = {0, 3, 8, 10, 11};
+    lists[3] = {5, 6};
+
+    list.merge_all(lists.begin(), lists.end());
+
+    ASSERT_EQ(list.size(), 12U);
+    ASSERT_THAT(list, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11));
+    for (const auto &other : lists)
+    {
+        ASSERT_TRUE(other.empty());
+    }
+}
+
+TEST(LIST, MERGE_ALL_STABLE)
+{
+    using Pair = std::pair<int, int>;
+    const auto isLess = [](const Pair &left, const Pair &right)
+    {
+        return (left.first < right.first);
+    };
+
+    // The second value is the index of the list
+    xor_list<Pair> list{{1, 0}, {2, 0}, {2, 0}};
+    std::vector<xor_list<Pair>> lists(3);
+    lists[0] = {{0, 1}, {2, 1}, {3, 1}};
+    lists[1] = {{2, 2}};
+    lists[2] = {{1, 3}, {2, 3}, {3, 3}, {4, 3}};
+
+    list.merge_all(lists.begin(), lists.end(), isLess);
+
+    ASSERT_EQ(list.size(), 11U);
+    ASSERT_THAT(list, ::testing::ElementsAre(Pair(0, 1), Pair(1, 0), Pair(1, 3), Pair(2, 0), Pair(2, 0), Pair(2, 1),
+                                             Pair(2, 2), Pair(2, 3), Pair(3, 1), Pair(3, 3), Pair(4, 3)));
+    ASSERT_TRUE(std::equal(std::reverse_iterator<xor_list<Pair>::const_iterator>(list.cend()),
+                           std::reverse_iterator<xor_list<Pair>::const_iterator>(list.cbegin()),
+                           std::vector<Pair>{{4, 3}, {3, 3}, {3, 1}, {2, 3}, {2, 2}, {2, 1}, {2, 0}, {2, 0},
+                                             {1, 3}, {1, 0}, {0, 1}}.cbegin()));
+}
+
+TEST(LIST, MERGE_ALL_THROWING_COMPARE)
+{
+    xor_list<int> list{0, 10, 20};
+    std::vector<xor_list<int>> lists{{1, 11, 21}, {2, 12, 22}, {3, 13, 23}};
+
+    int comparisons = 0;
+    ASSERT_THROW(list.merge_all(lists.begin(), lists.end(), [&comparisons](int left, int right)
+                                {
+                                    if (++comparisons == 15)
+                                    {
+                                        throw std::runtime_error("compare");
+                                    }
+                                    return (left < right);
+                                }), std::runtime_error);
+
+    // Every element is in *this once, in some order
+    std::vector<int> elements(list.cbegin(), list.cend());
+    std::sort(elements.begin(), elements.end());
+
+    ASSERT_EQ(list.size(), 12U);
+    ASSERT_EQ(elements, (std::vector<int>{0, 1, 2, 3, 10, 11, 12, 13, 20, 21, 22, 23}));
+    ASSERT_EQ(std::distance(std::reverse_iterator<xor_list<int>::const_iterator>(list.cend()),
+                            std::reverse_iterator<xor_list<int>::const_iterator>(list.cbegin())), 12);
+    for (const auto &other : lists)
+    {
+        ASSERT_TRUE(other.empty());
+    }
+}
+
+TEST(LIST, MERGE_UNIQUE)
+{
+    xor_list<Value<int>> list{1, 3, 5, 7, 9}, list2{0, 1, 2, 3, 4, 9, 10, 11};
+
+    ASSERT_EQ(list.merge_unique(list2), 3U);
+
+    ASSERT_EQ(list.size(), 10U);
+    ASSERT_TRUE(list2.empty());
+    ASSERT_EQ(list2.size(), 0U);
+    ASSERT_THAT(list, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 7, 9, 10, 11));
+    ASSERT_THAT(std::vector<int>(std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cend()),
+                                 std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cbegin())),
+                ::testing::ElementsAre(11, 10, 9, 7, 5, 4, 3, 2, 1, 0));
+
+    ASSERT_EQ(list.merge_unique(list), 0U);
+    ASSERT_EQ(list.size(), 10U);
+}
+
+TEST(LIST, MERGE_UNIQUE_MULTISET)
+{
+    using Pair = std::pair<int, int>;
+
+    const auto isLess = [](const Pair &left, const Pair &right)
+    {
+        return (left.first < right.first);
+    };
+
+    xor_list<Pair> list{{1, 0}, {1, 0}, {2, 0}}, list2{{1, 1}, {1, 1}, {1, 1}, {3, 1}};
+
+    ASSERT_EQ(list.merge_unique(list2, isLess), 2U);
+
+    ASSERT_THAT(list, ::testing::ElementsAre(Pair(1, 0), Pair(1, 0), Pair(1, 1), Pair(2, 0), Pair(3, 1)));
+}
+
+TEST(LIST, MERGE_UNIQUE_DOESNT_ALLOCATE)
+{
+    xor_list<Value<int>, CountingAllocator<Value<int>>> list{2, 4, 6}, list2{1, 2, 3, 4};
+
+    AllocationCounter::reset();
+
+    ASSERT_EQ(list.merge_unique(list2), 2U);
+
+    ASSERT_EQ(AllocationCounter::allocations, 0);
+    ASSERT_EQ(AllocationCounter::deallocations, 2);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 6));
+}
+
+TEST(LIST, MERGE_UNIQUE_THROWING_COMPARE)
+{
+    xor_list<int> list{1, 3, 5, 7}, list2{2, 3, 4, 6, 8};
+    int comparisons = 0;
+
+    ASSERT_THROW(list.merge_unique(list2, [&comparisons](int left, int right)
+                                   {
+                                       if (++comparisons == 8)
+                                       {
+                                           throw std::runtime_error("compare");
+                                       }
+                                       return (left < right);
+                                   }), std::runtime_error);
+
+    // 3 of list2 is dropped, the rest is either in list or still in list2
+    std::vector<int> elements(list.cbegin(), list.cend());
+    elements.insert(elements.end(), list2.cbegin(), list2.cend());
+    std::sort(elements.begin(), elements.end());
+
+    ASSERT_EQ(list.size() + list2.size(), 8U);
+    ASSERT_EQ(elements, (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8}));
+    ASSERT_TRUE(std::is_sorted(list.cbegin(), list.cend()));
+}
+
+TEST(LIST, INTERSECT)
+{
+    xor_list<Value<int>> list{1, 2, 2, 3, 5, 8, 9, 10}, list2{0, 2, 3, 4, 8, 10, 11};
+
+    ASSERT_EQ(list.intersect(list2), 4U);
+
+    ASSERT_EQ(list.size(), 4U);
+    ASSERT_THAT(list, ::testing::ElementsAre(2, 3, 8, 10));
+    ASSERT_THAT(std::vector<int>(std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cend()),
+                                 std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cbegin())),
+                ::testing::ElementsAre(10, 8, 3, 2));
+    ASSERT_THAT(list2, ::testing::ElementsAre(0, 2, 3, 4, 8, 10, 11));
+
+    ASSERT_EQ(list.intersect(list), 0U);
+    ASSERT_EQ(list.intersect(xor_list<Value<int>>{}), 4U);
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(LIST, SUBTRACT)
+{
+    xor_list<Value<int>> list{1, 2, 2, 3, 5, 8, 9, 10}, list2{0, 2, 3, 4, 9};
+
+    ASSERT_EQ(list.subtract(list2), 3U);
+
+    ASSERT_EQ(list.size(), 5U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 5, 8, 10));
+    ASSERT_THAT(std::vector<int>(std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cend()),
+                                 std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cbegin())),
+                ::testing::ElementsAre(10, 8, 5, 2, 1));
+    ASSERT_THAT(list2, ::testing::ElementsAre(0, 2, 3, 4, 9));
+
+    ASSERT_EQ(list.subtract(xor_list<Value<int>>{}), 0U);
+    ASSERT_EQ(list.subtract(list), 5U);
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(LIST, SUBTRACT_FREES_AT_ONCE)
+{
+    xor_list<Value<int>, CountingAllocator<Value<int>>> list{1, 2, 3, 4, 5, 6}, list2{2, 3, 6};
+
+    AllocationCounter::reset();
+
+    ASSERT_EQ(list.subtract(list2), 3U);
+
+    ASSERT_EQ(AllocationCounter::allocations, 0);
+    ASSERT_EQ(AllocationCounter::deallocations, 3);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 4, 5));
+}
 
 TEST(LIST, SORT_EMPTY)
 {
@@ -724,6 +1032,445 @@ TEST(LIST, SORT_SORTED_REVERSE)
     ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 5, 6, 7, 8, 9));
 }
 
+TEST(LIST, SORT_RUNS_STABLE)
+{
+    // Ascending and descending runs with equal keys, sorted by the first element only
+    xor_list<std::pair<int, int>> list{{1, 0}, {3, 1}, {3, 2}, {5, 3}, {4, 4}, {3, 5}, {2, 6}, {2, 7}, {1, 8}, {6, 9}};
+
+    list.sort([](const std::pair<int, int> &left, const std::pair<int, int> &right)
+    {
+        return (left.first < right.first);
+    });
+
+    ASSERT_THAT(list, ::testing::ElementsAre(std::make_pair(1, 0), std::make_pair(1, 8), std::make_pair(2, 6),
+                                             std::make_pair(2, 7), std::make_pair(3, 1), std::make_pair(3, 2),
+                                             std::make_pair(3, 5), std::make_pair(4, 4), std::make_pair(5, 3),
+                                             std::make_pair(6, 9)));
+}
+
+TEST(LIST, SORT_NEARLY_SORTED)
+{
+    xor_list<Value<int>> list;
+    std::vector<int> expected;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        list.push_back(i * 2);
+        expected.push_back(i * 2);
+    }
+    for (int i = 0; i < 10; ++i)
+    {
+        list.push_back(i * 201 + 1);
+        expected.push_back(i * 201 + 1);
+    }
+    for (int i = 100; i > 0; --i)
+    {
+        list.push_back(i * 3);
+        expected.push_back(i * 3);
+    }
+
+    list.sort();
+    std::sort(expected.begin(), expected.end());
+
+    ASSERT_EQ(list.size(), expected.size());
+    ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), list.cbegin()));
+}
+
+TEST(LIST, SORT_BUFFER_STABLE)
+{
+    using Pair = std::pair<int, int>;
+    const auto isLess = [](const Pair &left, const Pair &right)
+    {
+        return (left.first < right.first);
+    };
+
+    std::vector<Pair> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        expected.emplace_back((i * 7919) % 13, i);
+    }
+
+    xor_list<Pair> list;
+    xor_list<Pair, std::allocator<Pair>, xor_list_untracked_size> untracked;
+    list.assign(expected.cbegin(), expected.cend());
+    untracked.assign(expected.cbegin(), expected.cend());
+
+    // 0 makes any list go through the pointer buffer
+    list.sort(isLess, 0);
+    untracked.sort(isLess, 0);
+    std::stable_sort(expected.begin(), expected.end(), isLess);
+
+    ASSERT_EQ(list.size(), expected.size());
+    ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), list.cbegin()));
+    ASSERT_TRUE(std::equal(expected.crbegin(), expected.crend(),
+                           std::reverse_iterator<xor_list<Pair>::const_iterator>(list.cend())));
+
+    ASSERT_EQ(untracked.size(), expected.size());
+    ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), untracked.cbegin()));
+}
+
+TEST(LIST, SORT_BUFFER_THROWING_COMPARE)
+{
+    xor_list<int> list;
+    for (int i = 0; i < 100; ++i)
+    {
+        list.push_back((i * 37) % 100);
+    }
+
+    int comparisons = 0;
+    ASSERT_THROW(list.sort([&comparisons](int left, int right)
+                           {
+                               if (++comparisons == 300)
+                               {
+                                   throw std::runtime_error("compare");
+                               }
+                               return (left < right);
+                           }, 0), std::runtime_error);
+
+    // Every element is still linked once, in some order
+    std::vector<int> elements(list.cbegin(), list.cend());
+    std::sort(elements.begin(), elements.end());
+
+    ASSERT_EQ(list.size(), 100U);
+    ASSERT_EQ(elements.size(), 100U);
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(elements[i], i);
+    }
+    ASSERT_EQ(std::distance(std::reverse_iterator<xor_list<int>::const_iterator>(list.cend()),
+                            std::reverse_iterator<xor_list<int>::const_iterator>(list.cbegin())), 100);
+}
+
+TEST(LIST, SORT_NODES_THROWING_COMPARE)
+{
+    // Throws while cutting the first run, extending it by insertion and merging the runs
+    for (const int throwAt : {1, 10, 100, 400, 700})
+    {
+        xor_list<int> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back((i * 37) % 100);
+        }
+
+        int comparisons = 0;
+        ASSERT_THROW(list.sort([&comparisons, throwAt](int left, int right)
+                               {
+                                   if (++comparisons == throwAt)
+                                   {
+                                       throw std::runtime_error("compare");
+                                   }
+                                   return (left < right);
+                               }, std::numeric_limits<std::size_t>::max()), std::runtime_error);
+
+        // Every element is still linked once, in some order
+        std::vector<int> elements(list.cbegin(), list.cend());
+        std::sort(elements.begin(), elements.end());
+
+        ASSERT_EQ(list.size(), 100U);
+        ASSERT_EQ(elements.size(), 100U);
+        for (int i = 0; i < 100; ++i)
+        {
+            ASSERT_EQ(elements[i], i);
+        }
+        ASSERT_EQ(std::distance(std::reverse_iterator<xor_list<int>::const_iterator>(list.cend()),
+                                std::reverse_iterator<xor_list<int>::const_iterator>(list.cbegin())), 100);
+    }
+}
+
+TEST(LIST, SORT_PARALLEL_STABLE)
+{
+    using Pair = std::pair<int, int>;
+    const auto isLess = [](const Pair &left, const Pair &right)
+    {
+        return (left.first < right.first);
+    };
+
+    // Big enough for several chunks, with a chunk size that doesn't divide it
+    std::vector<Pair> expected;
+    for (int i = 0; i < 100003; ++i)
+    {
+        expected.emplace_back((i * 7919) % 1000, i);
+    }
+
+    xor_list<Pair> list;
+    xor_list<Pair, std::allocator<Pair>, xor_list_untracked_size> untracked;
+    list.assign(expected.cbegin(), expected.cend());
+    untracked.assign(expected.cbegin(), expected.cend());
+
+    list.sort(xor_list_parallel_policy{ 5 }, isLess);
+    untracked.sort(xor_list_parallel_policy{ 3 }, isLess);
+    std::stable_sort(expected.begin(), expected.end(), isLess);
+
+    ASSERT_EQ(list.size(), expected.size());
+    ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), list.cbegin()));
+    ASSERT_TRUE(std::equal(expected.crbegin(), expected.crend(),
+                           std::reverse_iterator<xor_list<Pair>::const_iterator>(list.cend())));
+
+    ASSERT_EQ(untracked.size(), expected.size());
+    ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), untracked.cbegin()));
+}
+
+TEST(LIST, SORT_PARALLEL_SMALL)
+{
+    xor_list<Value<int>> list{1, -2, 5, 65, 3, 42, 67, 35, 7, -10};
+
+    list.sort(xor_list_parallel_policy{});
+
+    ASSERT_EQ(list.size(), 10U);
+    ASSERT_THAT(list, ::testing::ElementsAre(-10, -2, 1, 3, 5, 7, 35, 42, 65, 67));
+}
+
+TEST(LIST, RADIX_SORT_SIGNED)
+{
+    xor_list<int> list;
+    std::vector<int> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        const int value = ((i * 7919) % 2001 - 1000) * 65537;
+        list.push_back(value);
+        expected.push_back(value);
+    }
+    list.push_back(std::numeric_limits<int>::min());
+    list.push_back(std::numeric_limits<int>::max());
+    expected.push_back(std::numeric_limits<int>::min());
+    expected.push_back(std::numeric_limits<int>::max());
+
+    list.radix_sort();
+    std::sort(expected.begin(), expected.end());
+
+    ASSERT_EQ(list.size(), expected.size());
+    ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), list.cbegin()));
+    ASSERT_TRUE(std::equal(expected.crbegin(), expected.crend(),
+                           std::reverse_iterator<xor_list<int>::const_iterator>(list.cend())));
+}
+
+TEST(LIST, RADIX_SORT_KEY_STABLE)
+{
+    using Pair = std::pair<unsigned, int>;
+
+    std::vector<Pair> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        // Only the lowest and the highest bytes of the keys differ
+        expected.emplace_back(((i * 7919U) % 7U) | ((i % 3U) << 24), i);
+    }
+
+    xor_list<Pair> list;
+    list.assign(expected.cbegin(), expected.cend());
+
+    list.radix_sort([](const Pair &pair)
+    {
+        return pair.first;
+    });
+    std::stable_sort(expected.begin(), expected.end(), [](const Pair &left, const Pair &right)
+    {
+        return (left.first < right.first);
+    });
+
+    ASSERT_EQ(list.size(), expected.size());
+    ASSERT_TRUE(std::equal(expected.cbegin(), expected.cend(), list.cbegin()));
+}
+
+TEST(LIST, RADIX_SORT_THROWING_KEY)
+{
+    xor_list<unsigned> list;
+    std::vector<unsigned> expected;
+    for (unsigned i = 0; i < 100; ++i)
+    {
+        list.push_back((i * 37U) % 100U + ((i % 2U) << 8));
+        expected.push_back(list.back());
+    }
+    std::sort(expected.begin(), expected.end());
+
+    int calls = 0;
+    ASSERT_THROW(list.radix_sort([&calls](unsigned value)
+                                 {
+                                     // The first pass over the keys and the first byte go well
+                                     if (++calls == 250)
+                                     {
+                                         throw std::runtime_error("key");
+                                     }
+                                     return value;
+                                 }), std::runtime_error);
+
+    // Every element is still linked once, in some order
+    std::vector<unsigned> elements(list.cbegin(), list.cend());
+    std::sort(elements.begin(), elements.end());
+
+    ASSERT_EQ(elements, expected);
+    ASSERT_EQ(std::distance(std::reverse_iterator<xor_list<unsigned>::const_iterator>(list.cend()),
+                            std::reverse_iterator<xor_list<unsigned>::const_iterator>(list.cbegin())), 100);
+}
+
+TEST(LIST, SORT_BY_KEY_STABLE)
+{
+    using Pair = std::pair<std::string, int>;
+
+    xor_list<Pair> list{{"pear", 0}, {"apple", 1}, {"fig", 2}, {"apple", 3}, {"kiwi", 4}, {"fig", 5}};
+    int keyCalls = 0;
+
+    list.sort_by_key([&keyCalls](const Pair &pair)
+    {
+        ++keyCalls;
+        return pair.first;
+    });
+
+    ASSERT_EQ(keyCalls, 6);
+    ASSERT_EQ(list.size(), 6U);
+    ASSERT_THAT(list, ::testing::ElementsAre(Pair("apple", 1), Pair("apple", 3), Pair("fig", 2), Pair("fig", 5),
+                                             Pair("kiwi", 4), Pair("pear", 0)));
+    ASSERT_EQ((--list.cend())->second, 0);
+}
+
+TEST(LIST, SORT_BY_KEY_COMPARE)
+{
+    xor_list<Value<int>> list{1, -2, 5, 65, 3, 42, 67, 35, 7, -10};
+
+    list.sort_by_key([](const Value<int> &value)
+    {
+        return value.value;
+    }, std::greater<int>{});
+
+    ASSERT_EQ(list.size(), 10U);
+    ASSERT_THAT(list, ::testing::ElementsAre(67, 65, 42, 35, 7, 5, 3, 1, -2, -10));
+}
+
+TEST(LIST, SORT_BY_KEY_THROWING_KEY)
+{
+    xor_list<int> list{3, 1, 2, 5, 4};
+    int keyCalls = 0;
+
+    ASSERT_THROW(list.sort_by_key([&keyCalls](int value)
+                                  {
+                                      if (++keyCalls == 4)
+                                      {
+                                          throw std::runtime_error("key");
+                                      }
+                                      return value;
+                                  }), std::runtime_error);
+
+    ASSERT_EQ(list.size(), 5U);
+    ASSERT_THAT(list, ::testing::ElementsAre(3, 1, 2, 5, 4));
+}
+
+TEST(LIST, PARTIAL_SORT)
+{
+    xor_list<Value<int>> list{1, -2, 5, 65, 3, 42, 67, 35, 7, -10};
+
+    auto iter = list.partial_sort(4);
+
+    ASSERT_EQ(*iter, 5);
+    ASSERT_EQ(list.size(), 10U);
+    ASSERT_THAT(list, ::testing::ElementsAre(-10, -2, 1, 3, 5, 65, 42, 67, 35, 7));
+    ASSERT_THAT(std::vector<int>(std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cend()),
+                                 std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cbegin())),
+                ::testing::ElementsAre(7, 35, 67, 42, 65, 5, 3, 1, -2, -10));
+
+    iter = list.partial_sort(3, std::greater<Value<int>>{});
+    ASSERT_EQ(*iter, -10);
+    ASSERT_THAT(list, ::testing::ElementsAre(67, 65, 42, -10, -2, 1, 3, 5, 35, 7));
+
+    ASSERT_TRUE(list.partial_sort(0) == list.begin());
+    ASSERT_TRUE(list.partial_sort(10) == list.end());
+    ASSERT_THAT(list, ::testing::ElementsAre(-10, -2, 1, 3, 5, 7, 35, 42, 65, 67));
+}
+
+TEST(LIST, PARTIAL_SORT_STABLE)
+{
+    using Pair = std::pair<int, int>;
+
+    xor_list<Pair> list{{3, 0}, {1, 1}, {2, 2}, {1, 3}, {0, 4}, {2, 5}, {1, 6}, {3, 7}};
+    const auto isLess = [](const Pair &left, const Pair &right)
+    {
+        return (left.first < right.first);
+    };
+
+    list.partial_sort(5, isLess);
+
+    ASSERT_THAT(list, ::testing::ElementsAre(Pair(0, 4), Pair(1, 1), Pair(1, 3), Pair(1, 6), Pair(2, 2),
+                                             Pair(3, 0), Pair(2, 5), Pair(3, 7)));
+}
+
+TEST(LIST, PARTIAL_SORT_THROWING_COMPARE)
+{
+    xor_list<int> list{5, 3, 8, 1, 9, 2, 7};
+    int calls = 0;
+
+    ASSERT_THROW(list.partial_sort(3, [&calls](int left, int right)
+                                   {
+                                       if (++calls == 6)
+                                       {
+                                           throw std::runtime_error("compare");
+                                       }
+                                       return (left < right);
+                                   }), std::runtime_error);
+
+    ASSERT_EQ(list.size(), 7U);
+    ASSERT_THAT(list, ::testing::ElementsAre(5, 3, 8, 1, 9, 2, 7));
+}
+
+TEST(LIST, PARTIAL_SORT_UNTRACKED_SIZE)
+{
+    xor_list<int, std::allocator<int>, xor_list_untracked_size> list{4, 2, 9, 1, 7};
+
+    list.partial_sort(2);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 4, 9, 7));
+
+    list.partial_sort(5);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 4, 7, 9));
+}
+
+TEST(LIST, NTH_ELEMENT)
+{
+    xor_list<Value<int>> list{1, -2, 5, 65, 3, 42, 67, 35, 7, -10};
+
+    auto iter = list.nth_element(5);
+
+    ASSERT_EQ(*iter, 7);
+    ASSERT_EQ(std::distance(list.begin(), iter), 5);
+    ASSERT_EQ(list.size(), 10U);
+    ASSERT_TRUE(std::all_of(list.begin(), iter, [&iter](const Value<int> &value) { return !(*iter < value); }));
+    ASSERT_TRUE(std::all_of(iter, list.end(), [&iter](const Value<int> &value) { return !(value < *iter); }));
+
+    iter = list.nth_element(9);
+    ASSERT_EQ(*iter, 67);
+    ASSERT_TRUE(++iter == list.end());
+
+    ASSERT_TRUE(list.nth_element(10) == list.end());
+    ASSERT_EQ(*list.nth_element(0), -10);
+}
+
+TEST(LIST, PARTIAL_SORT_AND_NTH_ELEMENT_BEYOND_SIZE)
+{
+    const auto max = std::numeric_limits<std::size_t>::max();
+
+    for (const std::size_t k : {std::size_t(5), std::size_t(6), max})
+    {
+        xor_list<int> list{4, 2, 9, 1, 7};
+        ASSERT_TRUE(list.partial_sort(k) == list.end());
+        ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 4, 7, 9));
+
+        xor_list<int, std::allocator<int>, xor_list_untracked_size> untracked{4, 2, 9, 1, 7};
+        ASSERT_TRUE(untracked.partial_sort(k) == untracked.end());
+        ASSERT_THAT(untracked, ::testing::ElementsAre(1, 2, 4, 7, 9));
+    }
+
+    for (const std::size_t n : {std::size_t(5), std::size_t(6), max})
+    {
+        xor_list<int> list{4, 2, 9, 1, 7};
+        ASSERT_TRUE(list.nth_element(n) == list.end());
+        ASSERT_THAT(list, ::testing::ElementsAre(4, 2, 9, 1, 7));
+
+        xor_list<int, std::allocator<int>, xor_list_untracked_size> untracked{4, 2, 9, 1, 7};
+        ASSERT_TRUE(untracked.nth_element(n) == untracked.end());
+        ASSERT_THAT(untracked, ::testing::ElementsAre(4, 2, 9, 1, 7));
+    }
+
+    xor_list<int> list{4, 2, 9, 1, 7};
+    ASSERT_EQ(*list.nth_element(4), 9);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 4, 7, 9));
+}
+
 TEST(LIST, SORT_GENERIC1)
 {
     xor_list<Value<int>> list{1, -2, 5, 65, 3, 42, 67, 35, 7, -10};
@@ -1218,13 +1965,64 @@ TEST(LIST, REVERSE_GENERIC2)
 {
     xor_list<Value<int>> list{1, 2};
 
-    list.reverse();
+    list.reverse();
+
+    ASSERT_EQ(list.size(), 2U);
+    ASSERT_THAT(list, ::testing::ElementsAre(2, 1));
+}
+
+TEST(LIST, REVERSE_RANGE)
+{
+    xor_list<Value<int>> list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto reversed = list.reverse(std::next(list.cbegin(), 2), std::next(list.cbegin(), 6));
+
+    ASSERT_EQ(*reversed.first, 6);
+    ASSERT_EQ(*reversed.second, 7);
+    ASSERT_EQ(list.size(), 9U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 6, 5, 4, 3, 7, 8, 9));
+
+    // The whole list and the ends of it, the reversed range stays usable
+    reversed = list.reverse(list.cbegin(), list.cend());
+    ASSERT_THAT(list, ::testing::ElementsAre(9, 8, 7, 3, 4, 5, 6, 2, 1));
+    ASSERT_TRUE(reversed.first == list.begin());
+    ASSERT_TRUE(reversed.second == list.end());
+
+    list.reverse(list.cbegin(), std::next(list.cbegin(), 2));
+    list.reverse(std::prev(list.cend(), 3), list.cend());
+    ASSERT_THAT(list, ::testing::ElementsAre(8, 9, 7, 3, 4, 5, 1, 2, 6));
+    ASSERT_THAT(std::vector<int>(std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cend()),
+                                 std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cbegin())),
+                ::testing::ElementsAre(6, 2, 1, 5, 4, 3, 7, 9, 8));
+
+    // Empty and single element ranges are left as they are
+    list.reverse(list.cbegin(), list.cbegin());
+    list.reverse(list.cbegin(), std::next(list.cbegin()));
+    ASSERT_THAT(list, ::testing::ElementsAre(8, 9, 7, 3, 4, 5, 1, 2, 6));
+}
+
+TEST(LIST, ROTATE)
+{
+    xor_list<Value<int>> list{1, 2, 3, 4, 5};
+
+    auto oldFirst = list.rotate(std::next(list.cbegin(), 3));
+
+    ASSERT_EQ(*oldFirst, 1);
+    ASSERT_EQ(list.size(), 5U);
+    ASSERT_THAT(list, ::testing::ElementsAre(4, 5, 1, 2, 3));
+    ASSERT_THAT(std::vector<int>(std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cend()),
+                                 std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cbegin())),
+                ::testing::ElementsAre(3, 2, 1, 5, 4));
+
+    oldFirst = list.rotate(std::prev(list.cend()));
+    ASSERT_EQ(*oldFirst, 4);
+    ASSERT_THAT(list, ::testing::ElementsAre(3, 4, 5, 1, 2));
 
-    ASSERT_EQ(list.size(), 2U);
-    ASSERT_THAT(list, ::testing::ElementsAre(2, 1));
+    ASSERT_TRUE(list.rotate(list.cbegin()) == list.end());
+    ASSERT_TRUE(list.rotate(list.cend()) == list.begin());
+    ASSERT_THAT(list, ::testing::ElementsAre(3, 4, 5, 1, 2));
 }
 
-
 TEST(LIST, BACK_SINGLE)
 {
     xor_list<Value<int>> list{ 50 };
@@ -2311,6 +3109,31 @@ TEST(LIST, INSERT_RANGE_EXCEPTION2)
     ASSERT_THAT(list, ::testing::ElementsAre(100, 200, 300, 400));
 }
 
+TEST(LIST, RESIZE_EXCEPTION)
+{
+    xor_list<ThrowsOnCopyConstructValueCounted<int>> list{100, 200};
+
+    ThrowsOnCopyConstructValueCounted<int>::counter = 3;
+
+    ASSERT_ANY_THROW(list.resize(10, ThrowsOnCopyConstructValueCounted<int>(5)));
+
+    ASSERT_EQ(list.size(), 2U);
+    ASSERT_THAT(list, ::testing::ElementsAre(100, 200));
+}
+
+TEST(LIST, COPY_CONSTRUCTOR_EXCEPTION)
+{
+    xor_list<ThrowsOnCopyConstructValueCounted<int>> list{1, 2, 3, 4, 5};
+
+    ThrowsOnCopyConstructValueCounted<int>::counter = 4;
+
+    ASSERT_ANY_THROW(xor_list<ThrowsOnCopyConstructValueCounted<int>> copy(list));
+
+    ThrowsOnCopyConstructValueCounted<int>::counter = -1;
+
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 5));
+}
+
 TEST(LIST, REMOVE_EMPTY)
 {
     xor_list<Value<int>> list;
@@ -2385,6 +3208,73 @@ TEST(LIST, REMOVE_IF_MIDDLE)
     ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 8, 9, 10));
 }
 
+TEST(LIST, STABLE_PARTITION)
+{
+    xor_list<Value<int>> list{1, 2, 4, 3, 5, 6, 8, 10, 7, 9, 12};
+    int calls = 0;
+
+    auto point = list.stable_partition([&calls](const Value<int> &val)
+    {
+        ++calls;
+        return (val % 2 == 0);
+    });
+
+    ASSERT_EQ(calls, 11);
+    ASSERT_EQ(*point, 1);
+    ASSERT_EQ(std::distance(list.begin(), point), 6);
+    ASSERT_EQ(list.size(), 11U);
+    ASSERT_THAT(list, ::testing::ElementsAre(2, 4, 6, 8, 10, 12, 1, 3, 5, 7, 9));
+    ASSERT_THAT(std::vector<int>(std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cend()),
+                                 std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cbegin())),
+                ::testing::ElementsAre(9, 7, 5, 3, 1, 12, 10, 8, 6, 4, 2));
+}
+
+TEST(LIST, STABLE_PARTITION_ALL_OR_NONE)
+{
+    xor_list<Value<int>> list{1, 2, 3};
+
+    ASSERT_TRUE(list.stable_partition([](const Value<int> &) { return true; }) == list.end());
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3));
+
+    ASSERT_TRUE(list.stable_partition([](const Value<int> &) { return false; }) == list.begin());
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3));
+
+    xor_list<Value<int>> empty;
+    ASSERT_TRUE(empty.partition([](const Value<int> &) { return false; }) == empty.end());
+}
+
+TEST(LIST, PARTITION)
+{
+    xor_list<Value<int>> list{5, 1, 8, 3, 9, 2, 7};
+
+    auto point = list.partition([](const Value<int> &val) { return (val < 5); });
+
+    ASSERT_EQ(*point, 5);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 3, 2, 5, 8, 9, 7));
+}
+
+TEST(LIST, STABLE_PARTITION_THROWING_PREDICATE)
+{
+    xor_list<int> list{1, 2, 3, 4, 5, 6, 7};
+    int calls = 0;
+
+    ASSERT_THROW(list.stable_partition([&calls](int val)
+                                       {
+                                           if (++calls == 5)
+                                           {
+                                               throw std::runtime_error("predicate");
+                                           }
+                                           return (val % 2 == 0);
+                                       }), std::runtime_error);
+
+    ASSERT_EQ(list.size(), 7U);
+    std::vector<int> elements(list.cbegin(), list.cend());
+    std::sort(elements.begin(), elements.end());
+    ASSERT_THAT(elements, ::testing::ElementsAre(1, 2, 3, 4, 5, 6, 7));
+    ASSERT_EQ(std::distance(std::reverse_iterator<xor_list<int>::const_iterator>(list.cend()),
+                            std::reverse_iterator<xor_list<int>::const_iterator>(list.cbegin())), 7);
+}
+
 TEST(LIST, MAX_SIZE_INVOKE)
 {
     xor_list<Value<int>> list;
@@ -2485,3 +3375,440 @@ TEST(LIST, COMPARISON_GENERIC2)
     ASSERT_TRUE(list2 > list);
     ASSERT_TRUE(list2 >= list);
 }
+
+TEST(LIST, NODE_CACHE_DISABLED_BY_DEFAULT)
+{
+    AllocationCounter::reset();
+
+    {
+        xor_list<int, CountingAllocator<int>> list{1, 2, 3};
+
+        list.pop_back();
+        list.push_back(4);
+
+        ASSERT_EQ(list.capacity(), 3U);
+        ASSERT_EQ(AllocationCounter::allocations, 4);
+        ASSERT_EQ(AllocationCounter::deallocations, 1);
+    }
+
+    ASSERT_EQ(AllocationCounter::deallocations, 4);
+}
+
+TEST(LIST, RESERVE)
+{
+    AllocationCounter::reset();
+
+    {
+        xor_list<Value<int>, CountingAllocator<Value<int>>> list{1, 2};
+
+        list.reserve(1);
+        ASSERT_EQ(list.capacity(), 2U);
+
+        list.reserve(10);
+        ASSERT_EQ(list.capacity(), 10U);
+        ASSERT_EQ(AllocationCounter::allocations, 10);
+
+        for (int i = 3; i <= 10; ++i)
+        {
+            list.push_back(i);
+        }
+
+        ASSERT_EQ(AllocationCounter::allocations, 10);
+        ASSERT_EQ(list.capacity(), 10U);
+        ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 5, 6, 7, 8, 9, 10));
+    }
+
+    ASSERT_EQ(AllocationCounter::deallocations, 10);
+}
+
+TEST(LIST, NODE_CACHE_STEADY_STATE)
+{
+    AllocationCounter::reset();
+
+    xor_list<Value<int>, CountingAllocator<Value<int>>> list;
+
+    list.reserve(4);
+    list.assign({1, 2, 3, 4});
+
+    for (int i = 5; i < 100; ++i)
+    {
+        list.pop_front();
+        list.push_back(i);
+    }
+
+    ASSERT_EQ(AllocationCounter::allocations, 4);
+    ASSERT_EQ(AllocationCounter::deallocations, 0);
+    ASSERT_THAT(list, ::testing::ElementsAre(96, 97, 98, 99));
+
+    (void)list.erase(list.cbegin(), list.cend());
+    list.resize(3);
+
+    ASSERT_EQ(AllocationCounter::allocations, 4);
+    ASSERT_EQ(list.capacity(), 4U);
+}
+
+TEST(LIST, SHRINK_TO_FIT)
+{
+    AllocationCounter::reset();
+
+    xor_list<Value<int>, CountingAllocator<Value<int>>> list;
+
+    list.reserve(5);
+    list.assign({1, 2, 3});
+    list.clear();
+
+    ASSERT_EQ(list.capacity(), 5U);
+    ASSERT_EQ(AllocationCounter::deallocations, 0);
+
+    list.shrink_to_fit();
+
+    ASSERT_EQ(list.capacity(), 0U);
+    ASSERT_EQ(AllocationCounter::deallocations, 5);
+
+    list.push_back(1);
+    list.pop_back();
+
+    ASSERT_EQ(AllocationCounter::allocations, 6);
+    ASSERT_EQ(AllocationCounter::deallocations, 6);
+}
+
+TEST(LIST, NODE_CACHE_MOVE_AND_SWAP)
+{
+    AllocationCounter::reset();
+
+    {
+        xor_list<Value<int>, CountingAllocator<Value<int>>> l1{1}, l2{2, 3};
+
+        l1.reserve(4);
+
+        l1.swap(l2);
+        ASSERT_EQ(l1.capacity(), 2U);
+        ASSERT_EQ(l2.capacity(), 4U);
+
+        xor_list<Value<int>, CountingAllocator<Value<int>>> l3(std::move(l2));
+        ASSERT_EQ(l2.capacity(), 0U);
+        ASSERT_EQ(l3.capacity(), 4U);
+        ASSERT_THAT(l3, ::testing::ElementsAre(1));
+
+        l1 = std::move(l3);
+        ASSERT_EQ(l1.capacity(), 4U);
+        ASSERT_THAT(l1, ::testing::ElementsAre(1));
+
+        l1.push_back(2);
+        l1.push_back(3);
+        l1.push_back(4);
+        ASSERT_EQ(AllocationCounter::allocations, 6);
+    }
+
+    ASSERT_EQ(AllocationCounter::deallocations, 6);
+}
+
+TEST(LIST, COMPACT_EMPTY)
+{
+    xor_list<Value<int>> list;
+
+    list.compact();
+
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(LIST, COMPACT_GENERIC)
+{
+    AllocationCounter::reset();
+
+    {
+        xor_list<Value<int>, CountingAllocator<Value<int>>> list{5, 3, 1, 4, 2};
+
+        list.sort();
+        list.compact();
+
+        ASSERT_EQ(AllocationCounter::allocations, 10);
+        ASSERT_EQ(AllocationCounter::deallocations, 5);
+        ASSERT_EQ(list.size(), 5U);
+        ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 5));
+
+        int expected = 5;
+        for (auto iter = list.cend(); iter != list.cbegin(); --expected)
+        {
+            ASSERT_EQ(*--iter, expected);
+        }
+    }
+
+    ASSERT_EQ(AllocationCounter::deallocations, 10);
+}
+
+TEST(LIST, COMPACT_MOVE_ONLY)
+{
+    xor_list<NonCopyableValue<int>> list;
+
+    list.emplace_back(2);
+    list.emplace_front(1);
+    list.emplace_back(3);
+
+    list.compact();
+
+    int expected = 1;
+    for (const auto &value : list)
+    {
+        ASSERT_EQ(value, expected++);
+    }
+    ASSERT_EQ(expected, 4);
+}
+
+TEST(LIST, COMPACT_EXCEPTION)
+{
+    xor_list<ThrowsOnCopyConstructValueCounted<int>> list{1, 2, 3, 4};
+
+    ThrowsOnCopyConstructValueCounted<int>::counter = 3;
+    ASSERT_THROW(list.compact(), std::runtime_error);
+    ThrowsOnCopyConstructValueCounted<int>::counter = -1;
+
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4));
+}
+
+TEST(LIST, FOR_EACH)
+{
+    xor_list<int> list{1, 2, 3};
+
+    int calls = 0;
+    list.for_each([&calls](int &value)
+    {
+        value *= 2;
+        ++calls;
+    });
+
+    ASSERT_EQ(calls, 3);
+    ASSERT_THAT(list, ::testing::ElementsAre(2, 4, 6));
+
+    const xor_list<int> &constList = list;
+    int sum = 0;
+    (void)constList.for_each([&sum](const int &value) { sum += value; });
+
+    ASSERT_EQ(sum, 12);
+}
+
+TEST(LIST, FOR_EACH_EMPTY)
+{
+    xor_list<int> list;
+
+    const auto counter = list.for_each([](int &value) { value = 0; });
+    (void)counter;
+
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(LIST, SPLICE_RANGE_COUNTED)
+{
+    xor_list<Value<int>> list{1, 2, 3, 4, 5}, list2{6, 7, 8, 9, 10};
+
+    list.splice(std::next(list.cbegin()), list2, std::next(list2.cbegin()), std::prev(list2.cend()), 3);
+
+    ASSERT_EQ(list.size(), 8U);
+    ASSERT_EQ(list2.size(), 2U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 7, 8, 9, 2, 3, 4, 5));
+    ASSERT_THAT(list2, ::testing::ElementsAre(6, 10));
+
+    list.splice(list.cend(), list, list.cbegin(), std::next(list.cbegin(), 4), 4);
+
+    ASSERT_EQ(list.size(), 8U);
+    ASSERT_THAT(list, ::testing::ElementsAre(2, 3, 4, 5, 1, 7, 8, 9));
+}
+
+TEST(LIST, SPLIT)
+{
+    xor_list<Value<int>> list{1, 2, 3, 4, 5, 6};
+
+    auto tail = list.split(std::next(list.cbegin(), 4));
+
+    ASSERT_EQ(list.size(), 4U);
+    ASSERT_EQ(tail.size(), 2U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4));
+    ASSERT_THAT(tail, ::testing::ElementsAre(5, 6));
+
+    auto counted = list.split(std::next(list.cbegin()), 3);
+
+    ASSERT_EQ(list.size(), 1U);
+    ASSERT_EQ(counted.size(), 3U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1));
+    ASSERT_THAT(counted, ::testing::ElementsAre(2, 3, 4));
+    ASSERT_EQ(counted.back(), 4);
+
+    ASSERT_TRUE(list.split(list.cend()).empty());
+    ASSERT_THAT(list, ::testing::ElementsAre(1));
+
+    auto whole = list.split(list.cbegin());
+    ASSERT_TRUE(list.empty());
+    ASSERT_THAT(whole, ::testing::ElementsAre(1));
+}
+
+TEST(LIST, SPLIT_UNTRACKED_SIZE)
+{
+    xor_list<int, std::allocator<int>, xor_list_untracked_size> list{1, 2, 3, 4, 5};
+
+    auto tail = list.split(std::next(list.cbegin(), 2));
+
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2));
+    ASSERT_THAT(tail, ::testing::ElementsAre(3, 4, 5));
+    ASSERT_EQ(tail.size(), 3U);
+}
+
+TEST(LIST, CONCAT)
+{
+    xor_list<Value<int>> list{1, 2}, list2{3}, list3, list4{4, 5, 6};
+
+    list.concat({ &list2, nullptr, &list3, &list, &list4 });
+
+    ASSERT_EQ(list.size(), 6U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 5, 6));
+    ASSERT_THAT(std::vector<int>(std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cend()),
+                                 std::reverse_iterator<xor_list<Value<int>>::const_iterator>(list.cbegin())),
+                ::testing::ElementsAre(6, 5, 4, 3, 2, 1));
+    ASSERT_TRUE(list2.empty());
+    ASSERT_TRUE(list3.empty());
+    ASSERT_TRUE(list4.empty());
+    ASSERT_EQ(list4.size(), 0U);
+
+    list2.concat({ &list });
+    ASSERT_EQ(list2.size(), 6U);
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(LIST, ERASE_RANGE_COUNTED)
+{
+    xor_list<Value<int>> list{1, 2, 3, 4, 5};
+
+    auto iter = list.erase(std::next(list.cbegin()), std::prev(list.cend()), 3);
+
+    ASSERT_EQ(*iter, 5);
+    ASSERT_EQ(list.size(), 2U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 5));
+
+    iter = list.erase(list.cbegin(), list.cbegin(), 0);
+
+    ASSERT_EQ(*iter, 1);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 5));
+}
+
+TEST(LIST, ERASE_RANGE_COUNTS_WHILE_DESTROYING)
+{
+    AllocationCounter::reset();
+
+    xor_list<Value<int>, CountingAllocator<Value<int>>> list{1, 2, 3, 4, 5, 6};
+
+    list.reserve(8);
+    list.push_back(7);
+    list.push_back(8);
+
+    // Two nodes go to the cache, the rest are freed
+    (void)list.erase(std::next(list.cbegin()), list.cend());
+
+    ASSERT_EQ(list.size(), 1U);
+    ASSERT_EQ(list.capacity(), 3U);
+    ASSERT_EQ(AllocationCounter::deallocations, 5);
+    ASSERT_THAT(list, ::testing::ElementsAre(1));
+
+    list.shrink_to_fit();
+    (void)list.erase(list.cbegin(), list.cend());
+
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(AllocationCounter::deallocations, 8);
+}
+
+TEST(LIST, INSERT_RANGE_COUNTED_INPUT_ITERATOR)
+{
+    xor_list<int> list{1, 5};
+    std::istringstream stream("2 3 4");
+
+    auto iter = list.insert(std::next(list.cbegin()), std::istream_iterator<int>(stream),
+                            std::istream_iterator<int>(), 3);
+
+    ASSERT_EQ(*iter, 2);
+    ASSERT_EQ(list.size(), 5U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 5));
+}
+
+TEST(LIST, INSERT_RANGE_COUNTED_EXCEPTION)
+{
+    const Value<int> values[] = {3, 4, 5};
+    xor_list<ThrowsOnCopyConstructValueCounted<int>> list{1, 2};
+
+    ThrowsOnCopyConstructValueCounted<int>::counter = 2;
+    ASSERT_THROW(list.insert(list.cend(), std::begin(values), std::end(values), 3), std::runtime_error);
+    ThrowsOnCopyConstructValueCounted<int>::counter = -1;
+
+    ASSERT_EQ(list.size(), 2U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2));
+}
+
+template<typename T>
+using untracked_list = xor_list<T, std::allocator<T>, xor_list_untracked_size>;
+
+TEST(LIST, UNTRACKED_SIZE_DROPS_COUNTER)
+{
+    ASSERT_LT(sizeof(untracked_list<int>), sizeof(xor_list<int>));
+}
+
+TEST(LIST, UNTRACKED_SIZE_GENERIC)
+{
+    untracked_list<Value<int>> list;
+
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.size(), 0U);
+
+    list.assign({5, 1, 4, 2, 3});
+    list.push_front(0);
+    list.pop_back();
+
+    ASSERT_FALSE(list.empty());
+    ASSERT_EQ(list.size(), 5U);
+
+    list.sort();
+    ASSERT_THAT(list, ::testing::ElementsAre(0, 1, 2, 4, 5));
+
+    list.resize(3);
+    ASSERT_THAT(list, ::testing::ElementsAre(0, 1, 2));
+
+    list.resize(4, 7);
+    ASSERT_THAT(list, ::testing::ElementsAre(0, 1, 2, 7));
+
+    (void)list.erase(list.cbegin(), std::next(list.cbegin(), 2));
+    ASSERT_EQ(list.size(), 2U);
+
+    list.clear();
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(LIST, UNTRACKED_SIZE_SPLICE_AND_MERGE)
+{
+    untracked_list<Value<int>> list{1, 3, 5}, list2{0, 2, 4, 6};
+
+    list.splice(list.cend(), list2, std::next(list2.cbegin()), std::prev(list2.cend()));
+
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 3, 5, 2, 4));
+    ASSERT_THAT(list2, ::testing::ElementsAre(0, 6));
+    ASSERT_EQ(list.size(), 5U);
+    ASSERT_EQ(list2.size(), 2U);
+
+    list.sort();
+    list.merge(list2);
+
+    ASSERT_THAT(list, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6));
+    ASSERT_TRUE(list2.empty());
+
+    list2.splice(list2.cend(), list);
+    list.swap(list2);
+
+    ASSERT_EQ(list.size(), 7U);
+    ASSERT_TRUE(list2.empty());
+}
+
+TEST(LIST, UNTRACKED_SIZE_COMPARISON)
+{
+    const untracked_list<int> list{1, 2, 3}, list2{1, 2}, list3{1, 2, 3};
+
+    ASSERT_TRUE(list == list3);
+    ASSERT_TRUE(list != list2);
+    ASSERT_TRUE(list2 != list);
+    ASSERT_TRUE(list2 < list);
+    ASSERT_FALSE(list < list3);
+}
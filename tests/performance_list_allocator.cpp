@@ -0,0 +1,159 @@
+#include <xor_list/xor_list.h>
+#include <xor_list/xor_pool_allocator.h>
+#include <xor_list/xor_arena_allocator.h>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <iterator>
+#include <string>
+
+
+template<typename List, typename Operation>
+std::chrono::duration<long double> measure(Operation operation)
+{
+    constexpr auto iterations = 10;
+
+    std::chrono::duration<long double> result = std::chrono::duration<long double>::zero();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        List list;
+
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        operation(list);
+
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+    }
+
+    return result / iterations;
+}
+
+// push_back all, then pop_front all
+template<typename List>
+std::chrono::duration<long double> measureQueue(std::uint64_t size)
+{
+    return measure<List>([size](List &list)
+    {
+        for (std::uint64_t i = 0; i < size; ++i)
+        {
+            list.push_back(static_cast<int>(i));
+        }
+        while (!list.empty())
+        {
+            list.pop_front();
+        }
+    });
+}
+
+// push_back all, erase every other element, push_back the erased count again
+template<typename List>
+std::chrono::duration<long double> measureErase(std::uint64_t size)
+{
+    return measure<List>([size](List &list)
+    {
+        for (std::uint64_t i = 0; i < size; ++i)
+        {
+            list.push_back(static_cast<int>(i));
+        }
+        for (auto iter = list.cbegin(); iter != list.cend(); )
+        {
+            iter = list.erase(iter);
+            if (iter != list.cend())
+            {
+                ++iter;
+            }
+        }
+        for (std::uint64_t i = 0; i < size / 2; ++i)
+        {
+            list.push_back(static_cast<int>(i));
+        }
+    });
+}
+
+// Steady state: 1000 elements, each step pushes one to the back and pops one from the front
+template<typename List>
+std::chrono::duration<long double> measureSteady(std::uint64_t size)
+{
+    return measure<List>([size](List &list)
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(i);
+        }
+        for (std::uint64_t i = 0; i < size; ++i)
+        {
+            list.push_back(static_cast<int>(i));
+            list.pop_front();
+        }
+    });
+}
+
+// The same with the node cache of the list (see xor_list::reserve())
+template<typename List>
+std::chrono::duration<long double> measureSteadyReserved(std::uint64_t size)
+{
+    return measure<List>([size](List &list)
+    {
+        list.reserve(1000);
+        for (int i = 0; i < 1000; ++i)
+        {
+            list.push_back(i);
+        }
+        for (std::uint64_t i = 0; i < size; ++i)
+        {
+            list.pop_front();
+            list.push_back(static_cast<int>(i));
+        }
+    });
+}
+
+// Scratch lists: the same list is filled with 100 elements and cleared again
+template<typename List>
+std::chrono::duration<long double> measureScratch(std::uint64_t size)
+{
+    return measure<List>([size](List &list)
+    {
+        for (std::uint64_t i = 0; i < size / 100; ++i)
+        {
+            for (int j = 0; j < 100; ++j)
+            {
+                list.emplace_back();
+            }
+            list.clear();
+        }
+    });
+}
+
+
+int main()
+{
+    using DefaultList = xor_list<int>;
+    using PoolList = xor_list<int, xor_pool_allocator<int>>;
+    using ArenaList = xor_list<int, xor_arena_allocator<int>>;
+    using DefaultStringList = xor_list<std::string>;
+    using ArenaStringList = xor_list<std::string, xor_arena_allocator<std::string>>;
+
+    for (std::uint64_t size = 1000U; size <= 10000000U; size *= 10)
+    {
+        std::cout << "Analyzed size : " << size << std::endl;
+        std::cout << "push_back/pop_front std::allocator : " << measureQueue<DefaultList>(size).count() << " sec." << std::endl;
+        std::cout << "push_back/pop_front ::xor_pool_allocator : " << measureQueue<PoolList>(size).count() << " sec." << std::endl;
+        std::cout << "erase std::allocator : " << measureErase<DefaultList>(size).count() << " sec." << std::endl;
+        std::cout << "erase ::xor_pool_allocator : " << measureErase<PoolList>(size).count() << " sec." << std::endl;
+        std::cout << "steady std::allocator : " << measureSteady<DefaultList>(size).count() << " sec." << std::endl;
+        std::cout << "steady ::xor_pool_allocator : " << measureSteady<PoolList>(size).count() << " sec." << std::endl;
+        std::cout << "steady std::allocator reserve() : " << measureSteadyReserved<DefaultList>(size).count() << " sec." << std::endl;
+        std::cout << "scratch std::allocator : " << measureScratch<DefaultList>(size).count() << " sec." << std::endl;
+        std::cout << "scratch ::xor_pool_allocator : " << measureScratch<PoolList>(size).count() << " sec." << std::endl;
+        std::cout << "scratch ::xor_arena_allocator : " << measureScratch<ArenaList>(size).count() << " sec." << std::endl;
+        std::cout << "scratch std::string std::allocator : "
+                  << measureScratch<DefaultStringList>(size).count() << " sec." << std::endl;
+        std::cout << "scratch std::string ::xor_arena_allocator : "
+                  << measureScratch<ArenaStringList>(size).count() << " sec." << std::endl;
+
+        std::cout << std::endl;
+    }
+}
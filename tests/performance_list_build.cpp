@@ -0,0 +1,104 @@
+#include <xor_list/xor_list.h>
+#include <xor_list/xor_arena_allocator.h>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <list>
+#include <vector>
+
+
+template<typename Operation>
+std::chrono::duration<long double> measure(Operation operation)
+{
+    constexpr auto iterations = 10;
+
+    std::chrono::duration<long double> result = std::chrono::duration<long double>::zero();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        operation();
+
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+    }
+
+    return result / iterations;
+}
+
+template<typename List>
+std::chrono::duration<long double> measurePushBack(const std::vector<int> &source)
+{
+    return measure([&source]()
+    {
+        List list;
+        for (const int value : source)
+        {
+            list.push_back(value);
+        }
+    });
+}
+
+template<typename List>
+std::chrono::duration<long double> measureAssign(const std::vector<int> &source)
+{
+    return measure([&source]()
+    {
+        List list;
+        list.assign(source.cbegin(), source.cend());
+    });
+}
+
+template<typename List>
+std::chrono::duration<long double> measureResize(std::uint64_t size)
+{
+    return measure([size]()
+    {
+        List list;
+        list.resize(size);
+    });
+}
+
+template<typename List>
+std::chrono::duration<long double> measureCopy(const std::vector<int> &source)
+{
+    List list;
+    list.assign(source.cbegin(), source.cend());
+
+    return measure([&list]()
+    {
+        const List copy(list);
+        (void)copy;
+    });
+}
+
+template<typename List>
+void measureAll(const char *const name, const std::vector<int> &source)
+{
+    std::cout << name << " push_back loop : " << measurePushBack<List>(source).count() << " sec." << std::endl;
+    std::cout << name << " assign(range) : " << measureAssign<List>(source).count() << " sec." << std::endl;
+    std::cout << name << " resize(n) : " << measureResize<List>(source.size()).count() << " sec." << std::endl;
+    std::cout << name << " copy construction : " << measureCopy<List>(source).count() << " sec." << std::endl;
+}
+
+
+int main()
+{
+    for (std::uint64_t size = 1000U; size <= 10000000U; size *= 10)
+    {
+        std::vector<int> source(size);
+        for (std::uint64_t i = 0; i < size; ++i)
+        {
+            source[i] = static_cast<int>(i);
+        }
+
+        std::cout << "Analyzed size : " << size << std::endl;
+        measureAll<xor_list<int>>("::xor_list", source);
+        measureAll<xor_list<int, xor_arena_allocator<int>>>("::xor_list ::xor_arena_allocator", source);
+        measureAll<std::list<int>>("std::list", source);
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,82 @@
+#include <xor_list/xor_list.h>
+#include <xor_list/xor_pool_allocator.h>
+#include <xor_list/xor_arena_allocator.h>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <numeric>
+
+
+// Sorting random values scatters the nodes: the list order doesn't follow the memory order anymore
+template<typename List>
+void fillScattered(List &list, std::uint64_t size)
+{
+    std::mt19937 generator(std::chrono::system_clock::now().time_since_epoch().count());
+    std::uniform_int_distribution<> distr;
+
+    for (std::uint64_t i = 0; i < size; ++i)
+    {
+        list.push_back(distr(generator));
+    }
+
+    list.sort();
+}
+
+template<typename List>
+std::chrono::duration<long double> measureTraversal(const List &list)
+{
+    constexpr auto iterations = 10;
+
+    std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+    long long sum = 0;
+    for (int i = 0; i < iterations; ++i)
+    {
+        sum += std::accumulate(list.cbegin(), list.cend(), 0LL);
+    }
+
+    std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+    // Prevents the loop from being optimized away
+    if (sum == 42)
+    {
+        std::cout << ' ';
+    }
+
+    return std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1) / iterations;
+}
+
+template<typename List>
+void measureAll(const char *const name, std::uint64_t size)
+{
+    List list;
+    fillScattered(list, size);
+
+    const auto before = measureTraversal(list);
+
+    std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+    list.compact();
+    std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+    const auto after = measureTraversal(list);
+
+    std::cout << name << " traversal before compact() : " << before.count() << " sec." << std::endl;
+    std::cout << name << " compact() : "
+              << std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1).count() << " sec." << std::endl;
+    std::cout << name << " traversal after compact() : " << after.count() << " sec." << std::endl;
+}
+
+
+int main()
+{
+    for (std::uint64_t size = 10000U; size <= 10000000U; size *= 10)
+    {
+        std::cout << "Analyzed size : " << size << std::endl;
+        measureAll<xor_list<int>>("::xor_list std::allocator", size);
+        measureAll<xor_list<int, xor_pool_allocator<int>>>("::xor_list ::xor_pool_allocator", size);
+        measureAll<xor_list<int, xor_arena_allocator<int>>>("::xor_list ::xor_arena_allocator", size);
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,97 @@
+#include <xor_list/xor_list.h>
+#include <xor_list/xor_slab_list.h>
+#include <list>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+
+// Counts bytes requested by a container (allocator bookkeeping overhead is not included)
+struct AllocationCounter
+{
+    std::size_t bytes = 0;
+};
+
+template<typename T>
+struct CountingAllocator : std::allocator<T>
+{
+public:
+    template<typename R>
+    struct rebind
+    {
+        using other = CountingAllocator<R>;
+    };
+
+
+    explicit CountingAllocator(AllocationCounter &counter) noexcept
+        : counter(&counter)
+    {
+    }
+
+    template<typename R>
+    CountingAllocator(const CountingAllocator<R> &other) noexcept
+        : std::allocator<T>(other), counter(other.counter)
+    {
+    }
+
+
+    T* allocate(std::size_t n)
+    {
+        counter->bytes += n * sizeof(T);
+        return std::allocator<T>::allocate(n);
+    }
+
+    void deallocate(T *p, std::size_t n)
+    {
+        counter->bytes -= n * sizeof(T);
+        std::allocator<T>::deallocate(p, n);
+    }
+
+
+    AllocationCounter *counter;
+};
+
+
+template<typename List>
+long double measureBytesPerElement(std::uint64_t size)
+{
+    using T = typename List::value_type;
+
+    AllocationCounter counter;
+    List list((CountingAllocator<T>(counter)));
+
+    for (std::uint64_t i = 0; i < size; ++i)
+    {
+        list.emplace_back();
+    }
+
+    return static_cast<long double>(counter.bytes) / size;
+}
+
+template<typename T>
+void report(const char *typeName)
+{
+    constexpr std::uint64_t size = 1000000U;
+
+    std::cout << "Analyzed type : " << typeName << " (sizeof = " << sizeof(T) << ')' << std::endl;
+    std::cout << "std::list : "
+              << measureBytesPerElement<std::list<T, CountingAllocator<T>>>(size) << " bytes/element" << std::endl;
+    std::cout << "::xor_list : "
+              << measureBytesPerElement<xor_list<T, CountingAllocator<T>>>(size) << " bytes/element" << std::endl;
+    std::cout << "::xor_slab_list : "
+              << measureBytesPerElement<xor_slab_list<T, CountingAllocator<T>>>(size) << " bytes/element" << std::endl;
+
+    std::cout << std::endl;
+}
+
+
+int main()
+{
+    report<char>("char");
+    report<int>("int");
+    report<std::uint64_t>("std::uint64_t");
+    report<long double>("long double");
+    report<std::string>("std::string");
+}
@@ -0,0 +1,147 @@
+#include <xor_list/xor_list.h>
+#include <list>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <iterator>
+#include <cstddef>
+
+
+std::vector<int> generateSorted(std::uint64_t size)
+{
+    std::mt19937 generator(std::chrono::system_clock::now().time_since_epoch().count());
+    std::uniform_int_distribution<> distr;
+
+    std::vector<int> result(size);
+    for (auto &value : result)
+    {
+        value = distr(generator);
+    }
+
+    std::sort(result.begin(), result.end());
+    return result;
+}
+
+// Sorted values in blocks of blockSize, the blocks of the two halves are interleaved:
+//  merging {even blocks} with {odd blocks} takes whole blocks from each side in turns
+std::vector<int> generateClustered(std::uint64_t size, std::uint64_t blockSize, bool odd)
+{
+    std::vector<int> result;
+    result.reserve(size);
+
+    for (std::uint64_t i = 0; i < size; ++i)
+    {
+        const std::uint64_t block = i / blockSize * 2 + (odd ? 1 : 0);
+        result.push_back(static_cast<int>(block * blockSize + i % blockSize));
+    }
+
+    return result;
+}
+
+template<typename List>
+std::chrono::duration<long double> measureMerge(const std::vector<int> &to, const std::vector<int> &from)
+{
+    constexpr auto iterations = 5;
+
+    std::chrono::duration<long double> result = std::chrono::duration<long double>::zero();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        List list, other;
+        list.assign(to.cbegin(), to.cend());
+        other.assign(from.cbegin(), from.cend());
+
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        list.merge(other);
+
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+    }
+
+    return result / iterations;
+}
+
+void measureAll(const char *const name, const std::vector<int> &to, const std::vector<int> &from)
+{
+    std::cout << "std::list merge " << name << " : "
+              << measureMerge<std::list<int>>(to, from).count() << " sec." << std::endl;
+    std::cout << "::xor_list merge " << name << " : "
+              << measureMerge<xor_list<int>>(to, from).count() << " sec." << std::endl;
+}
+
+// Total elements split into k sorted lists, merged into the first one
+template<typename List, typename MergeLists>
+std::chrono::duration<long double> measureMergeOfMany(std::uint64_t total, std::uint64_t k, MergeLists mergeLists)
+{
+    std::vector<List> lists(k);
+    for (std::uint64_t i = 0; i < k; ++i)
+    {
+        const auto values = generateSorted(total / k);
+        lists[i].assign(values.cbegin(), values.cend());
+    }
+
+    std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+    mergeLists(lists);
+
+    std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+}
+
+template<typename List>
+void mergeOneByOne(std::vector<List> &lists)
+{
+    for (std::size_t i = 1; i < lists.size(); ++i)
+    {
+        lists.front().merge(lists[i]);
+    }
+}
+
+
+int main()
+{
+    for (std::uint64_t size = 100000U; size <= 10000000U; size *= 10)
+    {
+        std::cout << "Analyzed size : " << size << std::endl;
+
+        const auto big = generateSorted(size);
+        const auto small = generateSorted(1000);
+        measureAll("(1K into big)", big, small);
+        measureAll("(big into 1K)", small, big);
+
+        const auto even = generateClustered(size, 1000, false);
+        const auto odd = generateClustered(size, 1000, true);
+        measureAll("(clustered, blocks of 1K)", even, odd);
+
+        const auto random = generateSorted(size);
+        measureAll("(random)", big, random);
+
+        std::cout << std::endl;
+    }
+
+    constexpr std::uint64_t total = 1000000U;
+    for (std::uint64_t k = 10U; k <= 1000U; k *= 10)
+    {
+        std::cout << "Analyzed " << total << " elements in " << k << " lists" << std::endl;
+
+        std::cout << "std::list merge one by one : "
+                  << measureMergeOfMany<std::list<int>>(total, k, mergeOneByOne<std::list<int>>).count()
+                  << " sec." << std::endl;
+        std::cout << "::xor_list merge one by one : "
+                  << measureMergeOfMany<xor_list<int>>(total, k, mergeOneByOne<xor_list<int>>).count()
+                  << " sec." << std::endl;
+        std::cout << "::xor_list merge_all : "
+                  << measureMergeOfMany<xor_list<int>>(total, k, [](std::vector<xor_list<int>> &lists)
+                  {
+                      lists.front().merge_all(std::next(lists.begin()), lists.end());
+                  }).count() << " sec." << std::endl;
+
+        std::cout << std::endl;
+    }
+}
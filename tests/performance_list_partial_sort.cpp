@@ -0,0 +1,88 @@
+#include <xor_list/xor_list.h>
+#include <list>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <functional>
+#include <cstddef>
+
+
+std::vector<int> generateInitializer(std::uint64_t size)
+{
+    std::mt19937 generator(std::chrono::system_clock::now().time_since_epoch().count());
+    std::uniform_int_distribution<> distr;
+
+    std::vector<int> result;
+    result.reserve(size);
+
+    while (size > 0)
+    {
+        result.push_back(distr(generator));
+        --size;
+    }
+
+    return result;
+}
+
+template<typename List, typename Select>
+std::chrono::duration<long double> measureSelection(const std::vector<int> &initializer, Select select)
+{
+    constexpr auto iterations = 5;
+
+    std::chrono::duration<long double> result = std::chrono::duration<long double>::zero();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        List list;
+        list.assign(initializer.cbegin(), initializer.cend());
+
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        select(list);
+
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+    }
+
+    return result / iterations;
+}
+
+
+int main()
+{
+    using List = xor_list<int>;
+
+    for (std::uint64_t size = 10000U; size <= 10000000U; size *= 10)
+    {
+        const auto initializer = generateInitializer(size);
+
+        std::cout << "Analyzed size : " << size << std::endl;
+        std::cout << "std::list sort() : " << measureSelection<std::list<int>>(initializer, [](std::list<int> &list)
+        {
+            list.sort();
+        }).count() << " sec." << std::endl;
+        std::cout << "::xor_list sort() : " << measureSelection<List>(initializer, [](List &list)
+        {
+            list.sort();
+        }).count() << " sec." << std::endl;
+
+        for (std::size_t k = 10U; k <= 10000U; k *= 10)
+        {
+            std::cout << "::xor_list partial_sort(" << k << ") : "
+                      << measureSelection<List>(initializer, [k](List &list)
+                      {
+                          (void)list.partial_sort(k);
+                      }).count() << " sec." << std::endl;
+        }
+
+        std::cout << "::xor_list nth_element(99) : " << measureSelection<List>(initializer, [](List &list)
+        {
+            (void)list.nth_element(99);
+        }).count() << " sec." << std::endl;
+
+        std::cout << std::endl;
+    }
+}
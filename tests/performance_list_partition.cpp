@@ -0,0 +1,95 @@
+#include <xor_list/xor_list.h>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <random>
+
+
+// Copying or swapping it costs much more than relinking a node
+struct Record
+{
+    std::uint32_t key;
+    char payload[252];
+};
+
+std::vector<std::uint32_t> generateKeys(std::uint64_t size)
+{
+    std::mt19937 generator(std::chrono::system_clock::now().time_since_epoch().count());
+    std::uniform_int_distribution<std::uint32_t> distr;
+
+    std::vector<std::uint32_t> result;
+    result.reserve(size);
+
+    while (size > 0)
+    {
+        result.push_back(distr(generator));
+        --size;
+    }
+
+    return result;
+}
+
+template<typename Partition>
+std::chrono::duration<long double> measurePartition(const std::vector<std::uint32_t> &keys, Partition partition)
+{
+    constexpr auto iterations = 10;
+
+    std::chrono::duration<long double> result = std::chrono::duration<long double>::zero();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        xor_list<Record> list;
+        for (const auto key : keys)
+        {
+            list.emplace_back();
+            list.back().key = key;
+        }
+
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        partition(list);
+
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+    }
+
+    return result / iterations;
+}
+
+
+int main()
+{
+    static_assert(sizeof(Record) == 256, "Record must take 256 bytes");
+
+    const auto isSmall = [](const Record &record)
+    {
+        return (record.key < 0x80000000U);
+    };
+
+    for (std::uint64_t size = 1000U; size <= 1000000U; size *= 10)
+    {
+        const auto keys = generateKeys(size);
+
+        std::cout << "Analyzed size : " << size << std::endl;
+        std::cout << "std::partition over ::xor_list iterators : "
+                  << measurePartition(keys, [&isSmall](xor_list<Record> &list)
+                  {
+                      (void)std::partition(list.begin(), list.end(), isSmall);
+                  }).count() << " sec." << std::endl;
+        std::cout << "std::stable_partition over ::xor_list iterators : "
+                  << measurePartition(keys, [&isSmall](xor_list<Record> &list)
+                  {
+                      (void)std::stable_partition(list.begin(), list.end(), isSmall);
+                  }).count() << " sec." << std::endl;
+        std::cout << "::xor_list partition() : "
+                  << measurePartition(keys, [&isSmall](xor_list<Record> &list)
+                  {
+                      (void)list.partition(isSmall);
+                  }).count() << " sec." << std::endl;
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,129 @@
+#include <xor_list/xor_list.h>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <functional>
+
+
+// Nodes are allocated in order of their values, then the list is relinked in random order
+xor_list<int> generateShuffled(std::uint64_t size)
+{
+    std::mt19937 generator(std::chrono::system_clock::now().time_since_epoch().count());
+    std::uniform_int_distribution<> distr;
+
+    xor_list<int> result;
+    for (std::uint64_t i = 0; i < size; ++i)
+    {
+        result.push_back(distr(generator));
+    }
+
+    result.sort();
+
+    return result;
+}
+
+template<typename Setup, typename Operation>
+std::chrono::duration<long double> measure(Setup setup, Operation operation)
+{
+    constexpr auto iterations = 5;
+
+    std::chrono::duration<long double> result = std::chrono::duration<long double>::zero();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        setup();
+
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        operation();
+
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+    }
+
+    return result / iterations;
+}
+
+template<typename Operation>
+std::chrono::duration<long double> measure(Operation operation)
+{
+    return measure([] {}, operation);
+}
+
+// Cheap work per element, which the load of the next node can overlap
+inline std::uint64_t work(std::uint64_t hash, int value)
+{
+    for (int i = 0; i < 64; ++i)
+    {
+        hash = (hash ^ static_cast<std::uint64_t>(value)) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+void measureAll(std::uint64_t size)
+{
+    const xor_list<int> list = generateShuffled(size);
+    const xor_list<int> copy = list;
+    std::uint64_t hash = 14695981039346656037ULL;
+
+    std::cout << "range-for : " << measure([&list, &hash]
+    {
+        for (const int value : list)
+        {
+            hash = work(hash, value);
+        }
+    }).count() << " sec." << std::endl;
+
+    std::cout << "for_each() : " << measure([&list, &hash]
+    {
+        (void)list.for_each([&hash](const int value)
+        {
+            hash = work(hash, value);
+        });
+    }).count() << " sec." << std::endl;
+
+    std::cout << "operator== : " << measure([&list, &copy, &hash]
+    {
+        hash += (list == copy) ? 1 : 0;
+    }).count() << " sec." << std::endl;
+
+    // Copies are laid out sequentially, so the scratch lists are shuffled from scratch
+    xor_list<int> scratch;
+    std::cout << "unique() : " << measure([&scratch, size]
+    {
+        scratch = generateShuffled(size);
+    }, [&scratch]
+    {
+        scratch.unique(std::greater<int>{});
+    }).count() << " sec." << std::endl;
+
+    std::cout << "sort() : " << measure([&scratch, size]
+    {
+        scratch = generateShuffled(size);
+    }, [&scratch]
+    {
+        scratch.sort(std::greater<int>{});
+    }).count() << " sec." << std::endl;
+
+    if (hash == 42)
+    {
+        std::cout << ' ';
+    }
+}
+
+
+int main()
+{
+#ifdef XOR_LIST_NO_PREFETCH
+    std::cout << "Prefetching is disabled" << std::endl;
+#endif
+
+    for (std::uint64_t size = 10000U; size <= 1000000U; size *= 10)
+    {
+        std::cout << "Analyzed size : " << size << std::endl;
+        measureAll(size);
+        std::cout << std::endl;
+    }
+}
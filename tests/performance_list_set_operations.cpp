@@ -0,0 +1,114 @@
+#include <xor_list/xor_list.h>
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <random>
+
+
+// Sorted unique IDs, about a half of them are shared by two lists generated with the same range
+std::vector<std::uint64_t> generateIds(std::uint64_t size)
+{
+    std::mt19937_64 generator(std::chrono::system_clock::now().time_since_epoch().count());
+    std::uniform_int_distribution<std::uint64_t> distr(0, size * 2);
+
+    std::vector<std::uint64_t> result;
+    result.reserve(size);
+
+    while (size > 0)
+    {
+        result.push_back(distr(generator));
+        --size;
+    }
+
+    std::sort(result.begin(), result.end());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+
+    return result;
+}
+
+template<typename Operation>
+std::chrono::duration<long double> measureOperation(const std::vector<std::uint64_t> &left,
+                                                    const std::vector<std::uint64_t> &right, Operation operation)
+{
+    constexpr auto iterations = 10;
+
+    std::chrono::duration<long double> result = std::chrono::duration<long double>::zero();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        xor_list<std::uint64_t> leftList, rightList;
+        leftList.assign(left.cbegin(), left.cend());
+        rightList.assign(right.cbegin(), right.cend());
+
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        operation(leftList, rightList);
+
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+    }
+
+    return result / iterations;
+}
+
+
+int main()
+{
+    using List = xor_list<std::uint64_t>;
+
+    for (std::uint64_t size = 10000U; size <= 1000000U; size *= 10)
+    {
+        const auto left = generateIds(size);
+        const auto right = generateIds(size);
+
+        std::cout << "Analyzed size : " << size << std::endl;
+
+        std::cout << "std::set_union into a new ::xor_list : "
+                  << measureOperation(left, right, [](List &leftList, List &rightList)
+                  {
+                      List result;
+                      std::set_union(leftList.cbegin(), leftList.cend(), rightList.cbegin(), rightList.cend(),
+                                     std::back_inserter(result));
+                      leftList.swap(result);
+                  }).count() << " sec." << std::endl;
+        std::cout << "::xor_list merge_unique() : "
+                  << measureOperation(left, right, [](List &leftList, List &rightList)
+                  {
+                      (void)leftList.merge_unique(rightList);
+                  }).count() << " sec." << std::endl;
+
+        std::cout << "std::set_intersection into a new ::xor_list : "
+                  << measureOperation(left, right, [](List &leftList, List &rightList)
+                  {
+                      List result;
+                      std::set_intersection(leftList.cbegin(), leftList.cend(), rightList.cbegin(), rightList.cend(),
+                                            std::back_inserter(result));
+                      leftList.swap(result);
+                  }).count() << " sec." << std::endl;
+        std::cout << "::xor_list intersect() : "
+                  << measureOperation(left, right, [](List &leftList, List &rightList)
+                  {
+                      (void)leftList.intersect(rightList);
+                  }).count() << " sec." << std::endl;
+
+        std::cout << "std::set_difference into a new ::xor_list : "
+                  << measureOperation(left, right, [](List &leftList, List &rightList)
+                  {
+                      List result;
+                      std::set_difference(leftList.cbegin(), leftList.cend(), rightList.cbegin(), rightList.cend(),
+                                          std::back_inserter(result));
+                      leftList.swap(result);
+                  }).count() << " sec." << std::endl;
+        std::cout << "::xor_list subtract() : "
+                  << measureOperation(left, right, [](List &leftList, List &rightList)
+                  {
+                      (void)leftList.subtract(rightList);
+                  }).count() << " sec." << std::endl;
+
+        std::cout << std::endl;
+    }
+}
@@ -1,9 +1,14 @@
 #include <xor_list/xor_list.h>
+#include <xor_list/xor_unrolled_list.h>
+#include <xor_list/xor_slab_list.h>
 #include <list>
 #include <cstdint>
 #include <iostream>
 #include <chrono>
 #include <random>
+#include <functional>
+#include <limits>
+#include <cstddef>
 
 
 std::list<int> generateInitializer(std::uint64_t size)
@@ -22,8 +27,60 @@ std::list<int> generateInitializer(std::uint64_t size)
     return result;
 }
 
-template<typename List>
-std::chrono::duration<long double> measureSorting(const std::list<int> &initializer)
+// Sorted, then a few random elements are appended
+std::list<int> generateNearlySorted(std::uint64_t size)
+{
+    auto result = generateInitializer(size - size / 100);
+    result.sort();
+
+    result.splice(result.cend(), generateInitializer(size / 100));
+
+    return result;
+}
+
+struct DefaultSort
+{
+    template<typename List>
+    void operator()(List &list) const
+    {
+        list.sort();
+    }
+};
+
+// Forces one mode of xor_list::sort: 0 always sorts through the pointer buffer, the max never does
+struct ThresholdSort
+{
+    std::size_t bufferThreshold;
+
+    template<typename List>
+    void operator()(List &list) const
+    {
+        list.sort(std::less<int>{}, bufferThreshold);
+    }
+};
+
+struct ParallelSort
+{
+    unsigned threads;
+
+    template<typename List>
+    void operator()(List &list) const
+    {
+        list.sort(xor_list_parallel_policy{ threads });
+    }
+};
+
+struct RadixSort
+{
+    template<typename List>
+    void operator()(List &list) const
+    {
+        list.radix_sort();
+    }
+};
+
+template<typename List, typename Sort = DefaultSort>
+std::chrono::duration<long double> measureSorting(const std::list<int> &initializer, Sort sortList = Sort{})
 {
     constexpr auto iterations = 10;
 
@@ -36,7 +93,7 @@ std::chrono::duration<long double> measureSorting(const std::list<int> &initiali
 
         std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
 
-        list.sort();
+        sortList(list);
 
         std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
 
@@ -56,6 +113,43 @@ int main()
         std::cout << "Analyzed size : " << size << std::endl;
         std::cout << "std::list : " << measureSorting<std::list<int>>(list).count() << " sec." << std::endl;
         std::cout << "::xor_list : " << measureSorting<xor_list<int>>(list).count() << " sec." << std::endl;
+        std::cout << "::xor_list (node merge sort) : "
+                  << measureSorting<xor_list<int>>(list, ThresholdSort{ std::numeric_limits<std::size_t>::max() }).count()
+                  << " sec." << std::endl;
+        std::cout << "::xor_list (pointer buffer sort) : "
+                  << measureSorting<xor_list<int>>(list, ThresholdSort{ 0 }).count() << " sec." << std::endl;
+        std::cout << "::xor_list radix_sort() : "
+                  << measureSorting<xor_list<int>>(list, RadixSort{}).count() << " sec." << std::endl;
+        for (unsigned threads = 1; threads <= 16; threads *= 2)
+        {
+            std::cout << "::xor_list (parallel, " << threads << " threads) : "
+                      << measureSorting<xor_list<int>>(list, ParallelSort{ threads }).count() << " sec." << std::endl;
+        }
+        std::cout << "::xor_slab_list : " << measureSorting<xor_slab_list<int>>(list).count() << " sec." << std::endl;
+        std::cout << "::xor_unrolled_list<4> : "
+                  << measureSorting<xor_unrolled_list<int, 4>>(list).count() << " sec." << std::endl;
+        std::cout << "::xor_unrolled_list<16> : "
+                  << measureSorting<xor_unrolled_list<int, 16>>(list).count() << " sec." << std::endl;
+        std::cout << "::xor_unrolled_list<64> : "
+                  << measureSorting<xor_unrolled_list<int, 64>>(list).count() << " sec." << std::endl;
+
+        auto sorted = list;
+        sorted.sort();
+        std::cout << "std::list (sorted) : " << measureSorting<std::list<int>>(sorted).count() << " sec." << std::endl;
+        std::cout << "::xor_list (sorted) : " << measureSorting<xor_list<int>>(sorted).count() << " sec." << std::endl;
+
+        auto reversed = sorted;
+        reversed.reverse();
+        std::cout << "std::list (reverse sorted) : "
+                  << measureSorting<std::list<int>>(reversed).count() << " sec." << std::endl;
+        std::cout << "::xor_list (reverse sorted) : "
+                  << measureSorting<xor_list<int>>(reversed).count() << " sec." << std::endl;
+
+        const auto nearlySorted = generateNearlySorted(size);
+        std::cout << "std::list (nearly sorted) : "
+                  << measureSorting<std::list<int>>(nearlySorted).count() << " sec." << std::endl;
+        std::cout << "::xor_list (nearly sorted) : "
+                  << measureSorting<xor_list<int>>(nearlySorted).count() << " sec." << std::endl;
 
         std::cout << std::endl;
     }
@@ -0,0 +1,119 @@
+#include <xor_list/xor_list.h>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <random>
+#include <string>
+#include <memory>
+#include <functional>
+#include <vector>
+
+
+// The sort key sits behind two indirections, away from the node
+struct Details
+{
+    std::string name;
+};
+
+struct Record
+{
+    std::unique_ptr<std::shared_ptr<Details>> details;
+    char payload[64];
+
+    const std::string& name() const
+    {
+        return (*details)->name;
+    }
+};
+
+std::vector<std::string> generateNames(std::uint64_t size)
+{
+    std::mt19937 generator(std::chrono::system_clock::now().time_since_epoch().count());
+    std::uniform_int_distribution<> distr;
+
+    std::vector<std::string> result;
+    result.reserve(size);
+
+    for (std::uint64_t i = 0; i < size; ++i)
+    {
+        // Common prefixes make every comparison walk a few characters
+        result.push_back("customer/region-" + std::to_string(distr(generator) % 16) + "/" + std::to_string(distr(generator)));
+    }
+
+    return result;
+}
+
+template<typename Sort>
+std::chrono::duration<long double> measureSorting(const std::vector<std::string> &names, Sort sortList)
+{
+    constexpr auto iterations = 5;
+
+    std::chrono::duration<long double> result = std::chrono::duration<long double>::zero();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        xor_list<Record> list;
+        for (const auto &name : names)
+        {
+            list.emplace_back();
+            list.back().details.reset(new std::shared_ptr<Details>(std::make_shared<Details>(Details{ name })));
+        }
+
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        sortList(list);
+
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+    }
+
+    return result / iterations;
+}
+
+
+int main()
+{
+    for (std::uint64_t size = 1000U; size <= 1000000U; size *= 10)
+    {
+        const auto names = generateNames(size);
+
+        std::cout << "Analyzed size : " << size << std::endl;
+
+        std::cout << "::xor_list sort(compare names) : "
+                  << measureSorting(names, [](xor_list<Record> &list)
+                  {
+                      list.sort([](const Record &left, const Record &right)
+                      {
+                          return (left.name() < right.name());
+                      });
+                  }).count() << " sec." << std::endl;
+        std::cout << "::xor_list sort_by_key(name) : "
+                  << measureSorting(names, [](xor_list<Record> &list)
+                  {
+                      list.sort_by_key([](const Record &record)
+                      {
+                          return record.name();
+                      });
+                  }).count() << " sec." << std::endl;
+
+        std::cout << "::xor_list sort(compare hashes of names) : "
+                  << measureSorting(names, [](xor_list<Record> &list)
+                  {
+                      list.sort([](const Record &left, const Record &right)
+                      {
+                          return (std::hash<std::string>{}(left.name()) < std::hash<std::string>{}(right.name()));
+                      });
+                  }).count() << " sec." << std::endl;
+        std::cout << "::xor_list sort_by_key(hash of name) : "
+                  << measureSorting(names, [](xor_list<Record> &list)
+                  {
+                      list.sort_by_key([](const Record &record)
+                      {
+                          return std::hash<std::string>{}(record.name());
+                      });
+                  }).count() << " sec." << std::endl;
+
+        std::cout << std::endl;
+    }
+}
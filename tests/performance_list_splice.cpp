@@ -0,0 +1,108 @@
+#include <xor_list/xor_list.h>
+#include <list>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <iterator>
+
+
+// Both lists are {0, segment...} in turns, the segment is moved between them back and forth
+// Iterators to the segment bounds are obtained in O(1), so only splice itself is measured
+template<typename List, typename Splice>
+std::chrono::duration<long double> measureSplice(std::uint64_t segmentSize, Splice splice)
+{
+    constexpr auto iterations = 10;
+
+    List source(segmentSize + 1, 1);
+    List target(1, 0);
+
+    std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        splice(target, target.cend(), source, std::next(source.cbegin()), source.cend(), segmentSize);
+        splice(source, source.cend(), target, std::next(target.cbegin()), target.cend(), segmentSize);
+    }
+
+    std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1) / (iterations * 2);
+}
+
+
+// The list is {0, segment...}, the segment is split off and concatenated back
+template<typename List, typename Split>
+std::chrono::duration<long double> measureSplitConcat(std::uint64_t segmentSize, Split split)
+{
+    constexpr auto iterations = 10;
+
+    List list(segmentSize + 1, 1);
+
+    std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        List tail = split(list, std::next(list.cbegin()), segmentSize);
+        list.concat({ &tail });
+    }
+
+    std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1) / iterations;
+}
+
+
+int main()
+{
+    using List = xor_list<int>;
+    using Iter = List::const_iterator;
+
+    for (std::uint64_t size = 10000U; size <= 10000000U; size *= 10)
+    {
+        std::cout << "Analyzed segment size : " << size << std::endl;
+
+        std::cout << "::xor_list splice(position, x, first, last) : "
+                  << measureSplice<List>(size, [](List &to, Iter position, List &from, Iter first, Iter last, std::uint64_t)
+                  {
+                      to.splice(position, from, first, last);
+                  }).count() << " sec." << std::endl;
+
+        std::cout << "::xor_list splice(position, x, first, last, count) : "
+                  << measureSplice<List>(size, [](List &to, Iter position, List &from, Iter first, Iter last,
+                                                  std::uint64_t count)
+                  {
+                      to.splice(position, from, first, last, count);
+                  }).count() << " sec." << std::endl;
+
+        using UntrackedList = xor_list<int, std::allocator<int>, xor_list_untracked_size>;
+        std::cout << "::xor_list<xor_list_untracked_size> splice(position, x, first, last) : "
+                  << measureSplice<UntrackedList>(size, [](UntrackedList &to, UntrackedList::const_iterator position,
+                                                           UntrackedList &from, UntrackedList::const_iterator first,
+                                                           UntrackedList::const_iterator last, std::uint64_t)
+                  {
+                      to.splice(position, from, first, last);
+                  }).count() << " sec." << std::endl;
+
+        std::cout << "::xor_list split(position) + concat : "
+                  << measureSplitConcat<List>(size, [](List &list, Iter position, std::uint64_t)
+                  {
+                      return list.split(position);
+                  }).count() << " sec." << std::endl;
+
+        std::cout << "::xor_list split(position, count) + concat : "
+                  << measureSplitConcat<List>(size, [](List &list, Iter position, std::uint64_t count)
+                  {
+                      return list.split(position, count);
+                  }).count() << " sec." << std::endl;
+
+        std::cout << "std::list splice(position, x, first, last) : "
+                  << measureSplice<std::list<int>>(size, [](std::list<int> &to, std::list<int>::const_iterator position,
+                                                            std::list<int> &from, std::list<int>::const_iterator first,
+                                                            std::list<int>::const_iterator last, std::uint64_t)
+                  {
+                      to.splice(position, from, first, last);
+                  }).count() << " sec." << std::endl;
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,91 @@
+#include <xor_list/xor_list.h>
+#include <xor_list/xor_pool_allocator.h>
+#include <xor_list/xor_arena_allocator.h>
+#include <cstdint>
+#include <iostream>
+#include <chrono>
+#include <iterator>
+#include <memory>
+#include <list>
+
+
+template<typename List, typename Teardown>
+std::chrono::duration<long double> measure(std::uint64_t size, Teardown teardown)
+{
+    constexpr auto iterations = 5;
+
+    std::chrono::duration<long double> result = std::chrono::duration<long double>::zero();
+
+    for (int i = 0; i < iterations; ++i)
+    {
+        std::unique_ptr<List> list(new List());
+        for (std::uint64_t j = 0; j < size; ++j)
+        {
+            list->push_back(static_cast<int>(j));
+        }
+
+        std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
+
+        teardown(list);
+
+        std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<std::chrono::duration<long double>>(t2 - t1);
+    }
+
+    return result / iterations;
+}
+
+template<typename List>
+std::chrono::duration<long double> measureDestructor(std::uint64_t size)
+{
+    return measure<List>(size, [](std::unique_ptr<List> &list)
+    {
+        list.reset();
+    });
+}
+
+template<typename List>
+std::chrono::duration<long double> measureClear(std::uint64_t size)
+{
+    return measure<List>(size, [](std::unique_ptr<List> &list)
+    {
+        list->clear();
+    });
+}
+
+// erase(first, last) of the second half
+template<typename List>
+std::chrono::duration<long double> measureEraseRange(std::uint64_t size)
+{
+    return measure<List>(size, [size](std::unique_ptr<List> &list)
+    {
+        auto middle = list->cbegin();
+        std::advance(middle, size / 2);
+
+        (void)list->erase(middle, list->cend());
+    });
+}
+
+template<typename List>
+void measureAll(const char *const name, std::uint64_t size)
+{
+    std::cout << name << " destructor : " << measureDestructor<List>(size).count() << " sec." << std::endl;
+    std::cout << name << " clear() : " << measureClear<List>(size).count() << " sec." << std::endl;
+    std::cout << name << " erase(first, last) : " << measureEraseRange<List>(size).count() << " sec." << std::endl;
+}
+
+
+int main()
+{
+    for (std::uint64_t size = 10000U; size <= 10000000U; size *= 10)
+    {
+        std::cout << "Analyzed size : " << size << std::endl;
+        measureAll<xor_list<int>>("::xor_list std::allocator", size);
+        measureAll<xor_list<int, xor_pool_allocator<int>>>("::xor_list ::xor_pool_allocator", size);
+        measureAll<xor_list<int, xor_arena_allocator<int>>>("::xor_list ::xor_arena_allocator", size);
+        measureAll<std::list<int>>("std::list", size);
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,183 @@
+#include <xor_list/xor_pool_allocator.h>
+#include <xor_list/xor_list.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <string>
+#include <utility>
+#include <iterator>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+
+template<typename T>
+using pool_list = xor_list<T, xor_pool_allocator<T, 4>>;
+
+
+TEST(POOL_ALLOCATOR, REUSES_BLOCKS)
+{
+    xor_pool_allocator<std::uint64_t, 4> allocator;
+
+    std::uint64_t *const first = allocator.allocate(1);
+    std::uint64_t *const second = allocator.allocate(1);
+
+    ASSERT_NE(first, second);
+
+    allocator.deallocate(first, 1);
+
+    ASSERT_EQ(allocator.allocate(1), first);
+
+    allocator.deallocate(first, 1);
+    allocator.deallocate(second, 1);
+}
+
+TEST(POOL_ALLOCATOR, ARRAYS_BYPASS_POOL)
+{
+    xor_pool_allocator<int, 4> allocator;
+
+    int *const array = allocator.allocate(100);
+    for (int i = 0; i < 100; ++i)
+    {
+        array[i] = i;
+    }
+
+    ASSERT_EQ(array[99], 99);
+    allocator.deallocate(array, 100);
+}
+
+TEST(POOL_ALLOCATOR, COPIES_AND_REBOUND_COPIES_ARE_EQUAL)
+{
+    xor_pool_allocator<int, 4> a1, a2;
+    xor_pool_allocator<std::string, 4> rebound(a1);
+    xor_pool_allocator<int, 4> back(rebound);
+
+    ASSERT_TRUE(a1 == rebound);
+    ASSERT_TRUE(back == a1);
+    ASSERT_TRUE(a1 != a2);
+
+    std::string *const s = rebound.allocate(1);
+    xor_pool_allocator<std::string, 4>(back).deallocate(s, 1);
+}
+
+TEST(POOL_ALLOCATOR, LIST_OPERATIONS)
+{
+    pool_list<std::string> list;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        list.push_back(std::to_string(i % 7));
+        list.push_front(std::to_string(i % 5));
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        list.pop_front();
+        (void)list.erase(std::next(list.cbegin(), 3));
+    }
+
+    list.sort();
+    list.unique();
+
+    ASSERT_THAT(list, ::testing::ElementsAre("0", "1", "2", "3", "4", "5", "6"));
+}
+
+TEST(POOL_ALLOCATOR, LIST_MOVE_AND_SWAP)
+{
+    pool_list<int> l1{1, 2, 3}, l2{4, 5};
+
+    l1.swap(l2);
+    ASSERT_THAT(l1, ::testing::ElementsAre(4, 5));
+    ASSERT_THAT(l2, ::testing::ElementsAre(1, 2, 3));
+
+    l1 = std::move(l2);
+    ASSERT_THAT(l1, ::testing::ElementsAre(1, 2, 3));
+
+    l2.push_back(10);
+    ASSERT_THAT(l2, ::testing::ElementsAre(10));
+
+    pool_list<int> l3(l1);
+    l1.clear();
+    ASSERT_THAT(l3, ::testing::ElementsAre(1, 2, 3));
+}
+
+TEST(POOL_ALLOCATOR, DEALLOCATE_CHAIN)
+{
+    xor_pool_allocator<void*, 4> allocator;
+
+    void **const first = allocator.allocate(1);
+    void **const second = allocator.allocate(1);
+    void **const third = allocator.allocate(1);
+
+    *first = second;
+    *second = third;
+    *third = nullptr;
+
+    allocator.deallocate_chain(first, third, 3);
+
+    ASSERT_EQ(allocator.allocate(1), first);
+    ASSERT_EQ(allocator.allocate(1), second);
+    ASSERT_EQ(allocator.allocate(1), third);
+
+    allocator.deallocate(first, 1);
+    allocator.deallocate(second, 1);
+    allocator.deallocate(third, 1);
+}
+
+TEST(POOL_ALLOCATOR, LIST_TEARDOWN)
+{
+    pool_list<int> list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    (void)list.erase(std::next(list.cbegin(), 2), std::next(list.cbegin(), 7));
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 8, 9));
+
+    list.reserve(6);
+    list.clear();
+    ASSERT_TRUE(list.empty());
+
+    list.assign({10, 11, 12});
+    list.shrink_to_fit();
+    ASSERT_THAT(list, ::testing::ElementsAre(10, 11, 12));
+}
+
+TEST(POOL_ALLOCATOR, LIST_COMPACT_IN_PLACE)
+{
+    pool_list<int> list;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        list.push_front(i);
+    }
+
+    list.sort();
+
+    std::vector<const int*> before;
+    for (const int &value : list)
+    {
+        before.push_back(&value);
+    }
+
+    list.compact();
+
+    std::vector<const int*> addresses;
+    for (const int &value : list)
+    {
+        addresses.push_back(&value);
+    }
+
+    // The same nodes, now in the address order
+    ASSERT_TRUE(std::is_sorted(addresses.cbegin(), addresses.cend(), std::less<const int*>{}));
+    std::sort(before.begin(), before.end(), std::less<const int*>{});
+    ASSERT_EQ(addresses, before);
+    ASSERT_THAT(list, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19));
+}
+
+TEST(POOL_ALLOCATOR, LIST_COMPACT_NON_MOVABLE)
+{
+    pool_list<std::string> list{"c", "a", "b"};
+
+    list.sort();
+    list.compact();
+
+    ASSERT_THAT(list, ::testing::ElementsAre("a", "b", "c"));
+}
@@ -0,0 +1,336 @@
+#include <xor_list/xor_slab_list.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <list>
+#include <string>
+#include <utility>
+#include <iterator>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+
+TEST(SLAB_LIST, CONSTRUCTOR_DEFAULT)
+{
+    xor_slab_list<int> list;
+
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.capacity(), 0U);
+    ASSERT_THAT(list, ::testing::ElementsAre());
+}
+
+TEST(SLAB_LIST, CONSTRUCTOR_INITIALIZER_LIST)
+{
+    xor_slab_list<int> list{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+
+    ASSERT_EQ(list.size(), 10U);
+    ASSERT_THAT(list, ::testing::ElementsAre(-1, 0, 1, 2, 3, 4, 5, 6, 7, 8));
+}
+
+TEST(SLAB_LIST, CONSTRUCTOR_VALUE_FILL)
+{
+    xor_slab_list<int> list(40U, -1590);
+
+    ASSERT_EQ(list.size(), 40U);
+    ASSERT_THAT(list, ::testing::Each(-1590));
+}
+
+TEST(SLAB_LIST, COPY_CONSTRUCTOR)
+{
+    xor_slab_list<std::string> l1{"1", "2", "3", "4", "5"}, l2(l1);
+
+    ASSERT_THAT(l2, ::testing::ElementsAre("1", "2", "3", "4", "5"));
+    ASSERT_EQ(l1, l2);
+}
+
+TEST(SLAB_LIST, MOVE_CONSTRUCTOR)
+{
+    xor_slab_list<int> l1{1, 2, 3, 4, 5, 6}, l2(std::move(l1));
+
+    ASSERT_TRUE(l1.empty());
+    ASSERT_THAT(l2, ::testing::ElementsAre(1, 2, 3, 4, 5, 6));
+}
+
+TEST(SLAB_LIST, ITERATORS_SURVIVE_GROWTH)
+{
+    xor_slab_list<std::string> list{"first", "second"};
+    const auto iter = ++list.cbegin();
+    const auto capacity = list.capacity();
+
+    while (list.capacity() == capacity)
+    {
+        list.push_back(*iter);
+    }
+
+    ASSERT_EQ(*iter, "second");
+    ASSERT_EQ(*--list.cend(), "second");
+    ASSERT_EQ(list.front(), "first");
+}
+
+TEST(SLAB_LIST, PUSH_SELF_ELEMENT)
+{
+    xor_slab_list<std::string> list;
+    list.push_back("0123456789012345678901234567890123456789");
+
+    for (int i = 0; i < 100; ++i)
+    {
+        list.push_back(list.front());
+    }
+
+    ASSERT_EQ(list.size(), 101U);
+    ASSERT_THAT(list, ::testing::Each(std::string("0123456789012345678901234567890123456789")));
+}
+
+TEST(SLAB_LIST, RESERVE)
+{
+    xor_slab_list<int> list{1, 2, 3};
+
+    list.reserve(1000);
+
+    ASSERT_GE(list.capacity(), 1000U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3));
+}
+
+TEST(SLAB_LIST, ERASE_REUSES_SLOTS)
+{
+    xor_slab_list<int> list;
+
+    for (int i = 0; i < 100; ++i)
+    {
+        list.push_back(i);
+    }
+
+    const auto capacity = list.capacity();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        (void)list.erase(list.cbegin(), std::next(list.cbegin(), 50));
+        list.resize(100, i);
+    }
+
+    ASSERT_EQ(list.capacity(), capacity);
+    ASSERT_EQ(list.size(), 100U);
+    ASSERT_THAT(std::vector<int>(list.cbegin(), std::next(list.cbegin(), 50)), ::testing::Each(8));
+    ASSERT_THAT(std::vector<int>(std::next(list.cbegin(), 50), list.cend()), ::testing::Each(9));
+}
+
+TEST(SLAB_LIST, CLEAR_KEEPS_SLAB)
+{
+    xor_slab_list<int> list{1, 2, 3, 4, 5};
+    const auto capacity = list.capacity();
+
+    list.clear();
+
+    ASSERT_TRUE(list.empty());
+    ASSERT_EQ(list.capacity(), capacity);
+
+    list.push_back(10);
+    ASSERT_THAT(list, ::testing::ElementsAre(10));
+}
+
+TEST(SLAB_LIST, INSERT_ERASE)
+{
+    xor_slab_list<int> list{1, 2, 5};
+
+    (void)list.insert(std::next(list.cbegin(), 2), 3);
+    (void)list.emplace(std::next(list.cbegin(), 3), 4);
+    (void)list.erase(list.cbegin());
+
+    ASSERT_THAT(list, ::testing::ElementsAre(2, 3, 4, 5));
+}
+
+TEST(SLAB_LIST, REVERSE)
+{
+    xor_slab_list<int> list{1, 2, 3, 4, 5};
+
+    list.reverse();
+
+    ASSERT_THAT(list, ::testing::ElementsAre(5, 4, 3, 2, 1));
+}
+
+TEST(SLAB_LIST, SPLICE_WHOLE_FROM_OTHER)
+{
+    xor_slab_list<int> l1{1, 2, 6}, l2{3, 4, 5};
+
+    l1.splice(std::next(l1.cbegin(), 2), l2);
+
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), 6U);
+    ASSERT_THAT(l1, ::testing::ElementsAre(1, 2, 3, 4, 5, 6));
+}
+
+TEST(SLAB_LIST, SPLICE_SINGLE)
+{
+    xor_slab_list<int> l1{1, 3}, l2{2, 4};
+
+    l1.splice(++l1.cbegin(), l2, l2.cbegin());
+    l1.splice(l1.cbegin(), l1, --l1.cend());
+
+    ASSERT_THAT(l1, ::testing::ElementsAre(3, 1, 2));
+    ASSERT_THAT(l2, ::testing::ElementsAre(4));
+}
+
+TEST(SLAB_LIST, SPLICE_RANGE)
+{
+    xor_slab_list<int> l1{1, 2, 3, 4, 5, 6}, l2{10, 20, 30};
+
+    l1.splice(l1.cbegin(), l1, std::next(l1.cbegin(), 3), l1.cend());
+    l1.splice(l1.cend(), l2, ++l2.cbegin(), l2.cend());
+
+    ASSERT_EQ(l1.size(), 8U);
+    ASSERT_EQ(l2.size(), 1U);
+    ASSERT_THAT(l1, ::testing::ElementsAre(4, 5, 6, 1, 2, 3, 20, 30));
+}
+
+TEST(SLAB_LIST, SORT_STABLE)
+{
+    xor_slab_list<std::pair<int, int>> list;
+
+    for (int i = 0; i < 50; ++i)
+    {
+        list.emplace_back((i * 7) % 5, i);
+    }
+
+    list.sort([](const std::pair<int, int> &l, const std::pair<int, int> &r) { return l.first < r.first; });
+
+    ASSERT_TRUE(std::is_sorted(list.cbegin(), list.cend()));
+}
+
+TEST(SLAB_LIST, SORT_THROWING_COMPARE)
+{
+    for (const int throwAt : {1, 10, 100, 400, 700})
+    {
+        xor_slab_list<int> list;
+        for (int i = 0; i < 100; ++i)
+        {
+            list.push_back((i * 37) % 100);
+        }
+
+        int comparisons = 0;
+        ASSERT_THROW(list.sort([&comparisons, throwAt](int left, int right)
+                               {
+                                   if (++comparisons == throwAt)
+                                   {
+                                       throw std::runtime_error("compare");
+                                   }
+                                   return (left < right);
+                               }), std::runtime_error);
+
+        // Every element is still linked once, in some order
+        std::vector<int> elements(list.cbegin(), list.cend());
+        std::sort(elements.begin(), elements.end());
+
+        ASSERT_EQ(list.size(), 100U);
+        ASSERT_EQ(elements.size(), 100U);
+        for (int i = 0; i < 100; ++i)
+        {
+            ASSERT_EQ(elements[i], i);
+        }
+        ASSERT_EQ(std::distance(std::reverse_iterator<xor_slab_list<int>::const_iterator>(list.cend()),
+                                std::reverse_iterator<xor_slab_list<int>::const_iterator>(list.cbegin())), 100);
+    }
+}
+
+TEST(SLAB_LIST, MERGE)
+{
+    xor_slab_list<int> l1{1, 3, 5, 7}, l2{0, 2, 4, 6, 8, 10};
+
+    l1.merge(l2);
+
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), 10U);
+    ASSERT_THAT(l1, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 10));
+}
+
+TEST(SLAB_LIST, MERGE_AND_SPLICE_GROW_SLAB)
+{
+    xor_slab_list<std::string> l1, l2, l3;
+    for (int i = 0; i < 16; ++i)
+    {
+        l1.push_back(std::string(20, static_cast<char>('a' + i)));
+        l2.push_back(std::string(20, static_cast<char>('a' + i)));
+        l3.push_back(std::string(20, static_cast<char>('a' + i)));
+    }
+    ASSERT_LT(l1.capacity(), l1.size() + l2.size());
+
+    l1.merge(l2);
+
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), 32U);
+    ASSERT_TRUE(std::is_sorted(l1.cbegin(), l1.cend()));
+    ASSERT_EQ(l1.front(), std::string(20, 'a'));
+    ASSERT_EQ(l1.back(), std::string(20, 'p'));
+
+    l1.splice(l1.cend(), l3);
+
+    ASSERT_TRUE(l3.empty());
+    ASSERT_EQ(l1.size(), 48U);
+    ASSERT_EQ(l1.back(), std::string(20, 'p'));
+}
+
+TEST(SLAB_LIST, SWAP_AND_ASSIGNMENT)
+{
+    xor_slab_list<int> l1{1, 2, 3}, l2{4};
+
+    l1.swap(l2);
+    ASSERT_THAT(l1, ::testing::ElementsAre(4));
+    ASSERT_THAT(l2, ::testing::ElementsAre(1, 2, 3));
+
+    l1 = l2;
+    ASSERT_EQ(l1, l2);
+
+    l2 = xor_slab_list<int>{7, 8};
+    ASSERT_THAT(l2, ::testing::ElementsAre(7, 8));
+    ASSERT_TRUE(l1 < l2);
+}
+
+TEST(SLAB_LIST, SMALL_INDEX_LIMIT)
+{
+    xor_slab_list<int, std::allocator<int>, std::uint8_t> list;
+
+    ASSERT_EQ(list.max_size(), 252U);
+
+    for (int i = 0; i < 252; ++i)
+    {
+        list.push_back(i);
+    }
+
+    ASSERT_THROW(list.push_back(0), std::length_error);
+    ASSERT_EQ(list.size(), 252U);
+    ASSERT_EQ(list.back(), 251);
+}
+
+TEST(SLAB_LIST, MIXED_OPERATIONS)
+{
+    xor_slab_list<int> list;
+    std::list<int> expected;
+
+    for (int i = 0; i < 300; ++i)
+    {
+        const auto offset = static_cast<std::size_t>((i * 7919) % (expected.size() + 1));
+
+        if ((i % 3 == 2) && (!expected.empty()))
+        {
+            const auto eraseOffset = offset % expected.size();
+            (void)list.erase(std::next(list.cbegin(), eraseOffset));
+            (void)expected.erase(std::next(expected.cbegin(), eraseOffset));
+        }
+        else
+        {
+            (void)list.insert(std::next(list.cbegin(), offset), i);
+            (void)expected.insert(std::next(expected.cbegin(), offset), i);
+        }
+    }
+
+    ASSERT_EQ(list.size(), expected.size());
+    ASSERT_TRUE(std::equal(list.cbegin(), list.cend(), expected.cbegin()));
+
+    list.sort();
+    expected.sort();
+    list.unique();
+    expected.unique();
+
+    ASSERT_EQ(list.size(), expected.size());
+    ASSERT_TRUE(std::equal(list.cbegin(), list.cend(), expected.cbegin()));
+}
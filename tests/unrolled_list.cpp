@@ -0,0 +1,429 @@
+#include <xor_list/xor_unrolled_list.h>
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <list>
+#include <string>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+
+
+// Small chunks make every operation cross chunk boundaries
+template<typename T>
+using small_unrolled_list = xor_unrolled_list<T, 4>;
+
+
+template<typename T>
+struct ThrowingLess
+{
+    int *counter;
+
+    bool operator()(const T &left, const T &right) const
+    {
+        if (--*counter == 0)
+        {
+            throw std::runtime_error("YEEEEAAH ROOOCCKKKKKKKKKKKKKKK");
+        }
+        return left < right;
+    }
+};
+
+
+TEST(UNROLLED_LIST, CONSTRUCTOR_DEFAULT)
+{
+    small_unrolled_list<int> list;
+
+    ASSERT_TRUE(list.empty());
+    ASSERT_THAT(list, ::testing::ElementsAre());
+}
+
+TEST(UNROLLED_LIST, CONSTRUCTOR_INITIALIZER_LIST)
+{
+    small_unrolled_list<int> list{-1, 0, 1, 2, 3, 4, 5, 6, 7, 8};
+
+    ASSERT_EQ(list.size(), 10U);
+    ASSERT_THAT(list, ::testing::ElementsAre(-1, 0, 1, 2, 3, 4, 5, 6, 7, 8));
+}
+
+TEST(UNROLLED_LIST, CONSTRUCTOR_VALUE_FILL)
+{
+    small_unrolled_list<int> list(9U, -1590);
+
+    ASSERT_EQ(list.size(), 9U);
+    ASSERT_THAT(list, ::testing::Each(-1590));
+}
+
+TEST(UNROLLED_LIST, COPY_CONSTRUCTOR)
+{
+    small_unrolled_list<std::string> l1{"1", "2", "3", "4", "5", "6", "7", "8", "9"}, l2(l1);
+
+    ASSERT_EQ(l2.size(), 9U);
+    ASSERT_THAT(l2, ::testing::ElementsAre("1", "2", "3", "4", "5", "6", "7", "8", "9"));
+    ASSERT_EQ(l1, l2);
+}
+
+TEST(UNROLLED_LIST, MOVE_CONSTRUCTOR)
+{
+    small_unrolled_list<int> l1{1, 2, 3, 4, 5, 6}, l2(std::move(l1));
+
+    ASSERT_TRUE(l1.empty());
+    ASSERT_THAT(l2, ::testing::ElementsAre(1, 2, 3, 4, 5, 6));
+}
+
+TEST(UNROLLED_LIST, PUSH_POP)
+{
+    small_unrolled_list<int> list;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        list.push_back(i);
+        list.push_front(-i);
+    }
+
+    ASSERT_EQ(list.size(), 20U);
+    ASSERT_THAT(list, ::testing::ElementsAre(-9, -8, -7, -6, -5, -4, -3, -2, -1, 0,
+                                             0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+
+    list.pop_front();
+    list.pop_back();
+    list.pop_back();
+
+    ASSERT_EQ(list.front(), -8);
+    ASSERT_EQ(list.back(), 7);
+    ASSERT_EQ(list.size(), 17U);
+}
+
+TEST(UNROLLED_LIST, ITERATOR_DECR)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+    std::list<int> reversed;
+
+    for (auto iter = list.cend(); iter != list.cbegin(); )
+    {
+        reversed.push_back(*--iter);
+    }
+
+    ASSERT_THAT(reversed, ::testing::ElementsAre(9, 8, 7, 6, 5, 4, 3, 2, 1));
+}
+
+TEST(UNROLLED_LIST, INSERT_INTO_FULL_CHUNK)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4};
+
+    auto iter = list.insert(std::next(list.cbegin(), 3), 100);
+    ASSERT_EQ(*iter, 100);
+
+    iter = list.insert(std::next(list.cbegin(), 1), 200);
+    ASSERT_EQ(*iter, 200);
+
+    ASSERT_EQ(list.size(), 6U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 200, 2, 3, 100, 4));
+}
+
+TEST(UNROLLED_LIST, INSERT_ELEMENT_OF_FULL_CHUNK)
+{
+    // Long strings, so a moved-from source would be visible
+    const std::string first(32, 'a'), last(32, 'd');
+
+    small_unrolled_list<std::string> list{first, "b", "c", last};
+    list.insert(std::next(list.cbegin()), list.back());
+    ASSERT_THAT(list, ::testing::ElementsAre(first, last, "b", "c", last));
+
+    small_unrolled_list<std::string> list2{first, "b", "c", last};
+    list2.insert(std::next(list2.cbegin(), 3), list2.front());
+    ASSERT_THAT(list2, ::testing::ElementsAre(first, "b", "c", first, last));
+}
+
+TEST(UNROLLED_LIST, INSERT_RANGE)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4, 5};
+    const int range[] = {10, 20, 30, 40, 50, 60};
+
+    auto iter = list.insert(std::next(list.cbegin(), 2), std::begin(range), std::end(range));
+
+    ASSERT_EQ(*iter, 10);
+    ASSERT_EQ(list.size(), 11U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 10, 20, 30, 40, 50, 60, 3, 4, 5));
+}
+
+TEST(UNROLLED_LIST, EMPLACE)
+{
+    small_unrolled_list<std::pair<int, std::string>> list;
+
+    list.emplace_back(1, "1");
+    list.emplace_front();
+    list.emplace(std::next(list.cbegin()), 2, "2");
+
+    ASSERT_EQ(list.size(), 3U);
+    ASSERT_THAT(list, ::testing::ElementsAre(std::make_pair(0, std::string()),
+                                             std::make_pair(2, std::string("2")),
+                                             std::make_pair(1, std::string("1"))));
+}
+
+TEST(UNROLLED_LIST, ERASE_SINGLE)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    auto iter = list.erase(std::next(list.cbegin(), 4));
+    ASSERT_EQ(*iter, 6);
+
+    iter = list.erase(list.cbegin());
+    ASSERT_EQ(*iter, 2);
+
+    iter = list.erase(--list.cend());
+    ASSERT_EQ(iter, list.end());
+
+    ASSERT_EQ(list.size(), 6U);
+    ASSERT_THAT(list, ::testing::ElementsAre(2, 3, 4, 6, 7, 8));
+}
+
+TEST(UNROLLED_LIST, ERASE_RANGE)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    auto iter = list.erase(std::next(list.cbegin(), 2), std::next(list.cbegin(), 9));
+
+    ASSERT_EQ(*iter, 10);
+    ASSERT_EQ(list.size(), 4U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 10, 11));
+
+    iter = list.erase(list.cbegin(), list.cend());
+
+    ASSERT_EQ(iter, list.end());
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(UNROLLED_LIST, REMOVE_IF)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    ASSERT_EQ(list.remove_if([](int value) { return (value % 3 != 0); }), 8U);
+
+    ASSERT_EQ(list.size(), 3U);
+    ASSERT_THAT(list, ::testing::ElementsAre(3, 6, 9));
+}
+
+TEST(UNROLLED_LIST, UNIQUE)
+{
+    small_unrolled_list<int> list{1, 1, 1, 2, 3, 3, 3, 3, 3, 4, 1, 1};
+
+    list.unique();
+
+    ASSERT_EQ(list.size(), 5U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 1));
+}
+
+TEST(UNROLLED_LIST, RESIZE)
+{
+    small_unrolled_list<int> list{1, 2, 3};
+
+    list.resize(7, 5);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 5, 5, 5, 5));
+
+    list.resize(2);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2));
+
+    list.resize(4);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 0, 0));
+}
+
+TEST(UNROLLED_LIST, ASSIGN)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4, 5, 6};
+
+    list.assign({7, 8});
+    ASSERT_THAT(list, ::testing::ElementsAre(7, 8));
+
+    list.assign(5U, 9);
+    ASSERT_THAT(list, ::testing::ElementsAre(9, 9, 9, 9, 9));
+}
+
+TEST(UNROLLED_LIST, REVERSE)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    list.reverse();
+
+    ASSERT_THAT(list, ::testing::ElementsAre(9, 8, 7, 6, 5, 4, 3, 2, 1));
+}
+
+TEST(UNROLLED_LIST, SPLICE_WHOLE_TO_MIDDLE)
+{
+    small_unrolled_list<int> l1{1, 2, 3, 4, 5, 6}, l2{10, 20, 30, 40, 50};
+
+    l1.splice(std::next(l1.cbegin(), 2), l2);
+
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), 11U);
+    ASSERT_THAT(l1, ::testing::ElementsAre(1, 2, 10, 20, 30, 40, 50, 3, 4, 5, 6));
+}
+
+TEST(UNROLLED_LIST, SPLICE_SINGLE)
+{
+    small_unrolled_list<int> l1{1, 2, 3}, l2{10, 20, 30};
+
+    l1.splice(l1.cend(), l2, std::next(l2.cbegin()));
+
+    ASSERT_THAT(l1, ::testing::ElementsAre(1, 2, 3, 20));
+    ASSERT_THAT(l2, ::testing::ElementsAre(10, 30));
+}
+
+TEST(UNROLLED_LIST, SPLICE_SINGLE_THIS)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4, 5, 6, 7};
+
+    list.splice(list.cbegin(), list, std::next(list.cbegin(), 5));
+    ASSERT_THAT(list, ::testing::ElementsAre(6, 1, 2, 3, 4, 5, 7));
+
+    list.splice(list.cend(), list, list.cbegin());
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 2, 3, 4, 5, 7, 6));
+}
+
+TEST(UNROLLED_LIST, SPLICE_RANGE)
+{
+    small_unrolled_list<int> l1{1, 2, 3, 4, 5}, l2{10, 20, 30, 40, 50, 60, 70, 80, 90};
+
+    l1.splice(std::next(l1.cbegin(), 3), l2, std::next(l2.cbegin(), 1), std::next(l2.cbegin(), 7));
+
+    ASSERT_EQ(l1.size(), 11U);
+    ASSERT_THAT(l1, ::testing::ElementsAre(1, 2, 3, 20, 30, 40, 50, 60, 70, 4, 5));
+
+    ASSERT_EQ(l2.size(), 3U);
+    ASSERT_THAT(l2, ::testing::ElementsAre(10, 80, 90));
+}
+
+TEST(UNROLLED_LIST, SPLICE_RANGE_THIS)
+{
+    small_unrolled_list<int> list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    list.splice(std::next(list.cbegin()), list, std::next(list.cbegin(), 6), std::next(list.cbegin(), 9));
+
+    ASSERT_EQ(list.size(), 10U);
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 7, 8, 9, 2, 3, 4, 5, 6, 10));
+
+    list.splice(list.cend(), list, std::next(list.cbegin()), std::next(list.cbegin(), 3));
+
+    ASSERT_THAT(list, ::testing::ElementsAre(1, 9, 2, 3, 4, 5, 6, 10, 7, 8));
+}
+
+TEST(UNROLLED_LIST, SORT_GENERIC)
+{
+    small_unrolled_list<int> list{5, -3, 8, 8, 0, 12, -40, 7, 3, 3, 1, 99, -2, 6};
+
+    list.sort();
+
+    ASSERT_EQ(list.size(), 14U);
+    ASSERT_THAT(list, ::testing::ElementsAre(-40, -3, -2, 0, 1, 3, 3, 5, 6, 7, 8, 8, 12, 99));
+}
+
+TEST(UNROLLED_LIST, SORT_STABLE)
+{
+    small_unrolled_list<std::pair<int, int>> list;
+
+    for (int i = 0; i < 20; ++i)
+    {
+        list.emplace_back(i % 3, i);
+    }
+
+    list.sort([](const std::pair<int, int> &l, const std::pair<int, int> &r) { return l.first < r.first; });
+
+    int prevFirst = 0, prevSecond = -1;
+    for (const auto &value : list)
+    {
+        if (value.first == prevFirst)
+        {
+            ASSERT_GT(value.second, prevSecond);
+        }
+        else
+        {
+            ASSERT_GT(value.first, prevFirst);
+        }
+
+        prevFirst = value.first;
+        prevSecond = value.second;
+    }
+}
+
+TEST(UNROLLED_LIST, SORT_EXCEPTION)
+{
+    small_unrolled_list<int> list{9, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1, -2, -3};
+    int counter = 25;
+
+    ASSERT_ANY_THROW(list.sort(ThrowingLess<int>{&counter}));
+
+    list.sort();
+
+    ASSERT_EQ(list.size(), 13U);
+    ASSERT_THAT(list, ::testing::ElementsAre(-3, -2, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+}
+
+TEST(UNROLLED_LIST, MERGE_GENERIC)
+{
+    small_unrolled_list<int> l1{1, 3, 5, 7, 9, 11}, l2{0, 2, 4, 6, 8, 10, 12, 14};
+
+    l1.merge(l2);
+
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), 14U);
+    ASSERT_THAT(l1, ::testing::ElementsAre(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 14));
+}
+
+TEST(UNROLLED_LIST, MERGE_TO_EMPTY)
+{
+    small_unrolled_list<int> l1, l2{0, 2, 4};
+
+    l1.merge(l2);
+
+    ASSERT_TRUE(l2.empty());
+    ASSERT_THAT(l1, ::testing::ElementsAre(0, 2, 4));
+}
+
+TEST(UNROLLED_LIST, SWAP)
+{
+    small_unrolled_list<int> l1{1, 2, 3, 4, 5}, l2{10};
+
+    l1.swap(l2);
+
+    ASSERT_THAT(l1, ::testing::ElementsAre(10));
+    ASSERT_THAT(l2, ::testing::ElementsAre(1, 2, 3, 4, 5));
+}
+
+TEST(UNROLLED_LIST, COMPARISON)
+{
+    small_unrolled_list<int> l1{1, 2, 3, 4, 5}, l2{1, 2, 3, 4, 6};
+
+    ASSERT_TRUE(l1 != l2);
+    ASSERT_TRUE(l1 < l2);
+    ASSERT_TRUE(l2 >= l1);
+}
+
+TEST(UNROLLED_LIST, MIXED_OPERATIONS)
+{
+    xor_unrolled_list<int, 3> list;
+    std::list<int> expected;
+
+    for (int i = 0; i < 200; ++i)
+    {
+        const auto offset = static_cast<std::size_t>((i * 7919) % (expected.size() + 1));
+
+        if ((i % 5 == 4) && (!expected.empty()))
+        {
+            const auto eraseOffset = offset % expected.size();
+            (void)list.erase(std::next(list.cbegin(), eraseOffset));
+            (void)expected.erase(std::next(expected.cbegin(), eraseOffset));
+        }
+        else
+        {
+            (void)list.insert(std::next(list.cbegin(), offset), i);
+            (void)expected.insert(std::next(expected.cbegin(), offset), i);
+        }
+    }
+
+    ASSERT_EQ(list.size(), expected.size());
+    ASSERT_TRUE(std::equal(list.cbegin(), list.cend(), expected.cbegin()));
+
+    list.sort();
+    expected.sort();
+
+    ASSERT_TRUE(std::equal(list.cbegin(), list.cend(), expected.cbegin()));
+}